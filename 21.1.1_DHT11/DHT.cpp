@@ -8,9 +8,124 @@
 * Reference   : https://github.com/RobTillaart/Arduino/tree/master/libraries/DHTlib
 **********************************************************************/
 #include "DHT.hpp"
+#include <fcntl.h>                                       // open()
+#include <unistd.h>                                      // read(), pread(), close()
+#include <stdlib.h>                                      // atoi()
+#include <string.h>                                      // memset(), strncpy(), strncmp()
+#include <errno.h>                                       // errno
+#include <dirent.h>                                      // opendir(), readdir()
+#include <poll.h>                                        // poll()
+#include <sys/ioctl.h>                                   // ioctl()
+#include <linux/gpio.h>                                  // GPIO character device v2 ABI
 
 DHT::DHT() {                                                                                                   
     wiringPiSetup();                                      // Initialize wiringPi
+    decoder = DHTLIB_DECODER_POLLING;                     // Keep the busy-wait decoder by default
+    iioTemperatureFd = -1;                                // IIO device not opened
+    iioHumidityFd = -1;
+    openIIO(DHTLIB_IIO_ROOT);                             // Prefer the kernel driver when the overlay is loaded
+}
+
+DHT::~DHT() {
+    closeIIO();                                          // Release IIO file descriptors
+}
+
+// Function to select the decoder used by readDHT11Once()
+void DHT::setDecoder(int decoder) {
+    this->decoder = decoder;                             // Store the selected decoder
+}
+
+// Function to get the decoder used by readDHT11Once()
+int DHT::getDecoder() {
+    return decoder;                                      // Return the selected decoder
+}
+
+// Function to open the first IIO device named "dht11" under root and select it
+// The attribute files stay open and are re-read with pread(), so a sample costs
+// two syscalls and the kernel driver does all the bit timing.
+// root is normally DHTLIB_IIO_ROOT; any directory with the same layout works.
+// Returns: true if the IIO device was found and selected
+bool DHT::openIIO(const char *root) {
+    char path[512];                                      // Attribute path
+    char name[32];                                       // Device name
+    struct dirent *entry;                                // Directory entry
+    DIR *dir;                                            // Device directory
+    int fd, n;                                           // Name file and read size
+
+    closeIIO();                                          // Drop any previous device
+    dir = opendir(root);                                 // List IIO devices
+    if (dir == NULL) {                                   // No IIO subsystem
+        return false;
+    }
+    while ((entry = readdir(dir)) != NULL) {             // Check each device
+        if (strncmp(entry->d_name, "iio:device", 10) != 0) {  // Skip triggers and dot entries
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s/name", root, entry->d_name);  // Build name path
+        fd = open(path, O_RDONLY | O_CLOEXEC);           // Open name file
+        if (fd < 0) {
+            continue;
+        }
+        n = read(fd, name, sizeof(name) - 1);            // Read device name
+        close(fd);                                       // Close name file
+        if (n < 5 || strncmp(name, "dht11", 5) != 0) {   // Not a dht11 device
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s/in_temp_input", root, entry->d_name);  // Build temperature path
+        iioTemperatureFd = open(path, O_RDONLY | O_CLOEXEC);  // Open temperature
+        snprintf(path, sizeof(path), "%s/%s/in_humidityrelative_input", root, entry->d_name);  // Build humidity path
+        iioHumidityFd = open(path, O_RDONLY | O_CLOEXEC);  // Open humidity
+        if (iioTemperatureFd >= 0 && iioHumidityFd >= 0) {  // Both attributes available
+            break;
+        }
+        closeIIO();                                      // Incomplete device, keep looking
+    }
+    closedir(dir);                                       // Close device directory
+
+    if (iioTemperatureFd < 0) {                          // No usable device
+        return false;
+    }
+    decoder = DHTLIB_DECODER_IIO;                        // Select the IIO driver
+    return true;
+}
+
+// Function to close the IIO device and fall back to the polling decoder
+void DHT::closeIIO() {
+    if (iioTemperatureFd >= 0) {                         // Close temperature
+        close(iioTemperatureFd);
+    }
+    if (iioHumidityFd >= 0) {                            // Close humidity
+        close(iioHumidityFd);
+    }
+    iioTemperatureFd = -1;                               // Mark as closed
+    iioHumidityFd = -1;
+    if (decoder == DHTLIB_DECODER_IIO) {                 // IIO no longer available
+        decoder = DHTLIB_DECODER_POLLING;                // Fall back to the polling decoder
+    }
+}
+
+// Function to read humidity and temperature from the IIO device
+// The driver reports milli-degrees Celsius and milli-percent, and fails a read
+// with ETIMEDOUT when the sensor does not answer or EIO when the data is bad.
+// Returns: DHTLIB_OK, DHTLIB_ERROR_CHECKSUM, DHTLIB_ERROR_TIMEOUT
+int DHT::readIIO() {
+    char buf[16];                                        // Attribute text
+    int n;                                               // Read size
+
+    n = pread(iioTemperatureFd, buf, sizeof(buf) - 1, 0);  // Read temperature, this triggers a sensor read
+    if (n > 0) {
+        buf[n] = 0;                                      // Terminate text
+        temperature = atoi(buf) / 1000.0;                // Convert from milli-degrees
+        n = pread(iioHumidityFd, buf, sizeof(buf) - 1, 0);  // Read humidity from the same sample
+    }
+    if (n <= 0) {                                        // Read failed
+        humidity = DHTLIB_INVALID_VALUE;                 // Set invalid humidity value
+        temperature = DHTLIB_INVALID_VALUE;              // Set invalid temperature value
+        return (n < 0 && errno == EIO) ? DHTLIB_ERROR_CHECKSUM : DHTLIB_ERROR_TIMEOUT;  // Map driver error
+    }
+    buf[n] = 0;                                          // Terminate text
+    humidity = atoi(buf) / 1000.0;                       // Convert from milli-percent
+    return DHTLIB_OK;                                    // Return OK
 }
 
 // Function to read sensor and store data in bits[]
@@ -89,13 +204,159 @@ int DHT::readSensor(int pin, int wakeupDelay) {
     return DHTLIB_OK;                                    // Return OK
 }
 
+// Function to decode the 40 data bits from a captured edge stream into data[0..4]
+// Every bit is a 50 us low followed by a 28 us (0) or 70 us (1) high, so only the
+// high pulse widths matter. The last 40 complete high pulses are the data bits,
+// which keeps decoding correct when the response preamble was not captured.
+// Returns: DHTLIB_OK, DHTLIB_ERROR_TIMEOUT
+int DHT::decodeEdges(const DHTEdge *edges, int count, uint8_t *data) {
+    uint32_t widths[DHTLIB_EDGE_MAX_EVENTS];             // High pulse widths in us
+    int pulses = 0;                                      // Number of complete high pulses
+    int i;                                               // Loop counter
+
+    for (i = 1; i < count && pulses < DHTLIB_EDGE_MAX_EVENTS; i++) {  // Pair each rising edge with the next falling edge
+        if (edges[i - 1].rising && !edges[i].rising) {   // High pulse found
+            widths[pulses++] = (edges[i].timestamp - edges[i - 1].timestamp) / 1000;  // Store its width in us
+        }
+    }
+    if (pulses < 40) {                                   // Transfer incomplete
+        return DHTLIB_ERROR_TIMEOUT;                     // Return timeout error
+    }
+
+    for (i = 0; i < 5; i++) {                            // Clear output bytes
+        data[i] = 0;                                     // Set each byte to 0
+    }
+    for (i = 0; i < 40; i++) {                           // Walk the last 40 pulses
+        if (widths[pulses - 40 + i] > DHTLIB_EDGE_BIT_LIMIT) {  // Long high pulse is a 1 bit
+            data[i / 8] |= 0x80 >> (i % 8);              // Set bit MSB first
+        }
+    }
+    return DHTLIB_OK;                                    // Return OK
+}
+
+// Function to start one or more sensors with a shared start pulse and capture their edges
+// All lines are requested together from the GPIO character device and driven low,
+// then switched to edge detecting inputs. The kernel timestamps every edge, so the
+// CPU sleeps in poll() during the transfers and preemption cannot corrupt the bit
+// timing. Edges are sorted by line into edges[i][0..edgeCount[i]-1].
+// Returns: DHTLIB_OK, DHTLIB_ERROR_GPIO
+int DHT::captureEdges(const int *pins, int count, int wakeupDelay,
+                      DHTEdge (*edges)[DHTLIB_EDGE_MAX_EVENTS], int *edgeCount) {
+    struct gpio_v2_line_request request;                 // Line request
+    struct gpio_v2_line_config config;                   // Input configuration
+    struct gpio_v2_line_values values;                   // Output values
+    struct gpio_v2_line_event events[DHTLIB_EDGE_MAX_EVENTS];  // Raw kernel events
+    struct pollfd pfd;                                   // Poll descriptor
+    uint64_t all;                                        // Mask of all requested lines
+    int chipFd, lineFd;                                  // File descriptors
+    int i, j, n;                                         // Loop counters and read size
+    unsigned int start;                                  // Capture start time in ms
+
+    if (count < 1 || count > GPIO_V2_LINES_MAX) {        // One request holds at most 64 lines
+        return DHTLIB_ERROR_GPIO;                        // Return GPIO error
+    }
+    all = count == 64 ? ~0ULL : (1ULL << count) - 1;
+
+    chipFd = open(DHTLIB_GPIOCHIP, O_RDWR | O_CLOEXEC);  // Open GPIO chip
+    if (chipFd < 0) {                                    // Check if chip was opened
+        return DHTLIB_ERROR_GPIO;                        // Return GPIO error
+    }
+
+    memset(&request, 0, sizeof(request));                // Clear request
+    for (i = 0; i < count; i++) {                        // Add every sensor line
+        request.offsets[i] = wpiPinToGpio(pins[i]);      // Convert wiringPi pin to BCM line offset
+        edgeCount[i] = 0;                                // Clear previous capture
+    }
+    request.num_lines = count;                           // Request all lines at once
+    strncpy(request.consumer, "DHT", sizeof(request.consumer) - 1);  // Name the consumer
+    request.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;     // Start as outputs
+    request.config.num_attrs = 1;                        // One attribute
+    request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;  // Initial output values
+    request.config.attrs[0].attr.values = all;           // Idle high
+    request.config.attrs[0].mask = all;                  // Applies to all lines
+    request.event_buffer_size = DHTLIB_EDGE_MAX_EVENTS * count;  // Room for every transfer (the kernel caps it at 1024)
+    if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {  // Request the lines
+        close(chipFd);                                   // Close GPIO chip
+        return DHTLIB_ERROR_GPIO;                        // Return GPIO error
+    }
+    close(chipFd);                                       // Line fd stays valid on its own
+    lineFd = request.fd;                                 // Keep line fd
+
+    values.bits = 0;                                     // Start signal: set all pins low together
+    values.mask = all;                                   // Applies to all lines
+    if (ioctl(lineFd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0) {  // Drive lines low
+        close(lineFd);                                   // Release lines
+        return DHTLIB_ERROR_GPIO;                        // Sensors were never woken
+    }
+    delay(wakeupDelay);                                  // Wait for wakeup delay
+
+    memset(&config, 0, sizeof(config));                  // Clear configuration
+    config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING;  // Release lines and detect both edges
+    if (ioctl(lineFd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) < 0) {  // Switch to inputs
+        close(lineFd);                                   // Release lines
+        return DHTLIB_ERROR_GPIO;                        // Return GPIO error
+    }
+
+    pfd.fd = lineFd;                                     // Poll the line fd
+    pfd.events = POLLIN;                                 // Wait for edge events
+    start = millis();                                    // Get current time
+    while (millis() - start < DHTLIB_EDGE_TIMEOUT) {     // Capture until idle or timed out
+        if (poll(&pfd, 1, DHTLIB_EDGE_IDLE) <= 0) {      // No edge on any line for DHTLIB_EDGE_IDLE ms
+            break;                                       // All transfers are over
+        }
+        n = read(lineFd, events, sizeof(events));        // Drain pending events
+        if (n <= 0) {                                    // Check for read error
+            break;                                       // Stop capturing
+        }
+        n /= sizeof(events[0]);                          // Convert bytes to events
+        for (i = 0; i < n; i++) {                        // Sort events by line
+            for (j = 0; j < count; j++) {                // Find the sensor of this line
+                if (request.offsets[j] == events[i].offset) {
+                    break;
+                }
+            }
+            if (j == count || edgeCount[j] >= DHTLIB_EDGE_MAX_EVENTS) {  // Unknown line or buffer full
+                continue;                                // Drop event
+            }
+            edges[j][edgeCount[j]].timestamp = events[i].timestamp_ns;  // Kernel timestamp
+            edges[j][edgeCount[j]].rising = events[i].id == GPIO_V2_LINE_EVENT_RISING_EDGE;  // Edge direction
+            edgeCount[j]++;                              // Next edge
+        }
+    }
+    close(lineFd);                                       // Release lines, pull-ups keep them high
+    return DHTLIB_OK;                                    // Return OK
+}
+
+// Function to read sensor and store data in bits[] using kernel edge timestamps
+// A capture of a single line, see captureEdges().
+// Returns: DHTLIB_OK, DHTLIB_ERROR_TIMEOUT, DHTLIB_ERROR_GPIO
+int DHT::readSensorEdges(int pin, int wakeupDelay) {
+    DHTEdge edges[1][DHTLIB_EDGE_MAX_EVENTS];            // Captured edges
+    int count;                                           // Number of captured edges
+    int rv;                                              // Return value
+
+    rv = captureEdges(&pin, 1, wakeupDelay, edges, &count);  // Start the sensor and capture its edges
+    if (rv != DHTLIB_OK) {                               // Check if capture was successful
+        return rv;                                       // Return GPIO error
+    }
+    return decodeEdges(edges[0], count, bits);           // Decode captured edges into bits[]
+}
+
 // Function to read DHT11 sensor once and analyze the data
+// With the IIO driver selected the pin is ignored; the overlay owns the pin.
 // Returns: DHTLIB_OK, DHTLIB_ERROR_CHECKSUM, DHTLIB_ERROR_TIMEOUT
 int DHT::readDHT11Once(int pin) {
     int rv;                                              // Return value
     uint8_t sum;                                         // Checksum
 
-    rv = readSensor(pin, DHTLIB_DHT11_WAKEUP);           // Read sensor data
+    if (decoder == DHTLIB_DECODER_IIO && iioTemperatureFd >= 0) {  // Kernel driver loaded
+        return readIIO();                                // Read values from the IIO device
+    }
+    if (decoder == DHTLIB_DECODER_EDGE) {                // Check selected decoder
+        rv = readSensorEdges(pin, DHTLIB_DHT11_WAKEUP);  // Read sensor data from edge timestamps
+    } else {
+        rv = readSensor(pin, DHTLIB_DHT11_WAKEUP);       // Read sensor data by polling
+    }
     if (rv != DHTLIB_OK) {                               // Check if reading was successful
         humidity = DHTLIB_INVALID_VALUE;                 // Set invalid humidity value
         temperature = DHTLIB_INVALID_VALUE;              // Set invalid temperature value
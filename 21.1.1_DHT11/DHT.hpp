@@ -18,21 +18,56 @@
 #define DHTLIB_OK               0            // Success flag
 #define DHTLIB_ERROR_CHECKSUM   -1           // Checksum error flag
 #define DHTLIB_ERROR_TIMEOUT    -2           // Timeout error flag
+#define DHTLIB_ERROR_GPIO       -3           // GPIO character device error flag
 #define DHTLIB_INVALID_VALUE    -999         // Invalid value flag
 
 #define DHTLIB_DHT11_WAKEUP     20           // Wake up delay for DHT11
 #define DHTLIB_DHT_WAKEUP       1            // Wake up delay for DHT
 #define DHTLIB_TIMEOUT          100          // Timeout for reading
 
+// Decoders used by readDHT11Once()
+#define DHTLIB_DECODER_POLLING  0            // Busy-wait on digitalRead() and micros()
+#define DHTLIB_DECODER_EDGE     1            // Kernel timestamped edges from the GPIO character device
+#define DHTLIB_DECODER_IIO      2            // Kernel dht11 IIO driver (dtoverlay=dht11)
+
+#define DHTLIB_IIO_ROOT         "/sys/bus/iio/devices"  // Where the kernel lists IIO devices
+
+#define DHTLIB_GPIOCHIP         "/dev/gpiochip0"  // GPIO character device of the header pins
+#define DHTLIB_EDGE_MAX_EVENTS  128          // Edge buffer size (a full transfer is about 86 edges)
+#define DHTLIB_EDGE_BIT_LIMIT   48           // High pulse width in us between a 0 bit (28 us) and a 1 bit (70 us)
+#define DHTLIB_EDGE_IDLE        2            // Quiet time in ms that ends an edge capture
+#define DHTLIB_EDGE_TIMEOUT     20           // Maximum duration in ms of an edge capture
+
+// One level change on the data line, timestamped by the kernel
+struct DHTEdge {
+    uint64_t timestamp;                      // Kernel timestamp in nanoseconds
+    uint8_t rising;                          // 1 for a rising edge, 0 for a falling edge
+};
+
 class DHT {      
     public:
-        DHT();                               // Constructor
+        DHT();                               // Constructor, selects the IIO driver when it is loaded
+        ~DHT();                              // Destructor
+        DHT(const DHT &) = delete;           // Owns the IIO file descriptors, not copyable
+        DHT &operator=(const DHT &) = delete;
         double humidity, temperature;        // Variables to store temperature and humidity data
         int readDHT11Once(int pin);          // Read DHT11 sensor once
         int readDHT11(int pin);              // Read DHT11 sensor with retries
+        void setDecoder(int decoder);        // Select DHTLIB_DECODER_POLLING, DHTLIB_DECODER_EDGE or DHTLIB_DECODER_IIO
+        int getDecoder();                    // Get the selected decoder
+        bool openIIO(const char *root);      // Open the first dht11 IIO device under root and select it
+        void closeIIO();                     // Close the IIO device
+        static int decodeEdges(const DHTEdge *edges, int count, uint8_t *data);  // Decode 5 bytes from captured edges
+        static int captureEdges(const int *pins, int count, int wakeupDelay,
+                                DHTEdge (*edges)[DHTLIB_EDGE_MAX_EVENTS], int *edgeCount);  // Start sensors together and capture their edges
     private:
         uint8_t bits[5];                     // Buffer to store sensor data
+        int decoder;                         // Decoder used by readDHT11Once()
         int readSensor(int pin, int wakeupDelay);  // Read sensor with specified wakeup delay
+        int readSensorEdges(int pin, int wakeupDelay);  // Read sensor from kernel edge timestamps
+        int iioTemperatureFd;                // in_temp_input of the IIO device, -1 if closed
+        int iioHumidityFd;                   // in_humidityrelative_input of the IIO device, -1 if closed
+        int readIIO();                       // Read humidity and temperature from the IIO device
 };
 
 #endif                                        // End of include guard
@@ -29,6 +29,8 @@ void loop() {
         printf("Sensor Status: Checksum Error\n");                        // Print checksum error message
     } else if (chk == DHTLIB_ERROR_TIMEOUT) {
         printf("Sensor Status: Timeout Error\n");                         // Print timeout error message
+    } else if (chk == DHTLIB_ERROR_GPIO) {
+        printf("Sensor Status: GPIO Error\n");                            // Print GPIO character device error message
     } else {
         printf("Sensor Status: Unknown Error\n");                         // Print unknown error message
     }
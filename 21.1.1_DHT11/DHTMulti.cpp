@@ -0,0 +1,65 @@
+/**********************************************************************
+* Filename    : DHTMulti.cpp
+* Description : Concurrent acquisition of several DHT11 sensors.
+*               All data lines are requested together from the GPIO
+*               character device, started with one shared start pulse and
+*               captured as one timestamped edge stream. Each sensor's edges
+*               are then decoded on their own, so a sweep of N sensors takes
+*               about as long as a single read.
+*               Used for Raspberry Pi.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+**********************************************************************/
+#include "DHTMulti.hpp"
+
+DHTMulti::DHTMulti() {
+    wiringPiSetup();                                     // Initialize wiringPi for the pin mapping
+    count = 0;                                           // No sensors yet
+}
+
+// Function to add a sensor
+// Returns: index of the sensor in the result arrays, -1 if full
+int DHTMulti::addPin(int pin) {
+    if (count >= DHTMULTI_MAX_PINS) {                    // Check capacity
+        return -1;                                       // No room left
+    }
+    pins[count] = pin;                                   // Store pin
+    status[count] = DHTLIB_ERROR_TIMEOUT;                // Not read yet
+    humidity[count] = DHTLIB_INVALID_VALUE;              // Set invalid humidity value
+    temperature[count] = DHTLIB_INVALID_VALUE;           // Set invalid temperature value
+    return count++;                                      // Return index
+}
+
+// Function to read all sensors at once and analyze the data
+// Returns: number of sensors read successfully, DHTLIB_ERROR_GPIO
+int DHTMulti::readAll() {
+    uint8_t bits[5];                                     // Data of one sensor
+    uint8_t sum;                                         // Checksum
+    int good = 0;                                        // Number of good reads
+    int i;                                               // Loop counter
+
+    if (count == 0) {                                    // Nothing to read
+        return 0;
+    }
+    if (DHT::captureEdges(pins, count, DHTLIB_DHT11_WAKEUP, edges, edgeCount) != DHTLIB_OK) {  // Capture all sensors
+        return DHTLIB_ERROR_GPIO;                        // Return GPIO error
+    }
+
+    for (i = 0; i < count; i++) {                        // Decode each sensor
+        status[i] = DHT::decodeEdges(edges[i], edgeCount[i], bits);  // Decode its edges
+        if (status[i] != DHTLIB_OK) {                    // Check if decoding was successful
+            humidity[i] = DHTLIB_INVALID_VALUE;          // Set invalid humidity value
+            temperature[i] = DHTLIB_INVALID_VALUE;       // Set invalid temperature value
+            continue;
+        }
+        humidity[i] = bits[0];                           // Extract humidity
+        temperature[i] = bits[2] + bits[3] * 0.1;        // Extract temperature
+        sum = bits[0] + bits[1] + bits[2] + bits[3];     // Calculate checksum
+        if (bits[4] != sum) {                            // Check if checksum is valid
+            status[i] = DHTLIB_ERROR_CHECKSUM;           // Checksum error
+            continue;
+        }
+        good++;                                          // Count good read
+    }
+    return good;                                         // Return number of good reads
+}
@@ -0,0 +1,31 @@
+/**********************************************************************
+* Filename    : DHTMulti.hpp
+* Description : Concurrent acquisition of several DHT11 sensors.
+*               Used for Raspberry Pi.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+**********************************************************************/
+#ifndef _DHTMULTI_H_                         // Include guard to prevent multiple inclusions
+#define _DHTMULTI_H_
+
+#include <stdint.h>                          // Include standard integer types
+#include "DHT.hpp"                           // Include DHT library for return flags, edge capture and decoding
+
+#define DHTMULTI_MAX_PINS       16           // Maximum number of sensors read together
+
+class DHTMulti {
+    public:
+        DHTMulti();                          // Constructor
+        int addPin(int pin);                 // Add a sensor on a wiringPi pin, returns its index or -1
+        int readAll();                       // Read all sensors at once, returns the number of good reads or DHTLIB_ERROR_GPIO
+        int count;                           // Number of sensors added
+        int pins[DHTMULTI_MAX_PINS];         // wiringPi pin of each sensor
+        int status[DHTMULTI_MAX_PINS];       // DHTLIB_OK, DHTLIB_ERROR_CHECKSUM or DHTLIB_ERROR_TIMEOUT of each sensor
+        double humidity[DHTMULTI_MAX_PINS];  // Humidity of each sensor
+        double temperature[DHTMULTI_MAX_PINS];  // Temperature of each sensor
+    private:
+        DHTEdge edges[DHTMULTI_MAX_PINS][DHTLIB_EDGE_MAX_EVENTS];  // Captured edges of each sensor
+        int edgeCount[DHTMULTI_MAX_PINS];    // Number of captured edges of each sensor
+};
+
+#endif                                        // End of include guard
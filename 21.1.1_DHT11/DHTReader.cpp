@@ -0,0 +1,165 @@
+/**********************************************************************
+* Filename    : DHTReader.cpp
+* Description : Non-blocking cached reader for the DHT class.
+*               A background thread owns the sensor timing: it samples no
+*               faster than the sensor allows, retries failed reads with a
+*               growing delay, and publishes the last good values. Callers
+*               only copy the cached values and never touch the sensor.
+*               Used for Raspberry Pi.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+**********************************************************************/
+#include "DHTReader.hpp"
+#include <string.h>                                      // memset()
+#include <time.h>                                        // clock_gettime()
+
+DHTReader::DHTReader(int pin, unsigned int interval) {
+    this->pin = pin;                                     // Store sensor pin
+    this->interval = interval < DHTREADER_INTERVAL ? DHTREADER_INTERVAL : interval;  // Never sample faster than the sensor allows
+    valid = false;                                       // No values yet
+    running = false;                                     // Thread not started
+    humidity = DHTLIB_INVALID_VALUE;                     // Set invalid humidity value
+    temperature = DHTLIB_INVALID_VALUE;                  // Set invalid temperature value
+    timestamp = 0;                                       // No sample time yet
+    memset(&stats, 0, sizeof(stats));                    // Clear counters
+    if (sensor.getDecoder() == DHTLIB_DECODER_POLLING) { // IIO driver not loaded
+        sensor.setDecoder(DHTLIB_DECODER_EDGE);          // Prefer the edge decoder, it does not sleep before the start pulse
+    }
+
+    pthread_condattr_t attr;                             // Condition attributes
+    pthread_condattr_init(&attr);                        // Initialize attributes
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);   // Timed waits use the monotonic clock
+    pthread_cond_init(&wake, &attr);                     // Initialize condition
+    pthread_condattr_destroy(&attr);                     // Release attributes
+    pthread_mutex_init(&lock, NULL);                     // Initialize mutex
+}
+
+DHTReader::~DHTReader() {
+    stop();                                              // Make sure the thread is gone
+    pthread_cond_destroy(&wake);                         // Release condition
+    pthread_mutex_destroy(&lock);                        // Release mutex
+}
+
+// Function to start the sampling thread
+// Returns: true if the thread is running
+bool DHTReader::start() {
+    pthread_mutex_lock(&lock);                           // Lock state
+    if (!running) {                                      // Only start once
+        running = pthread_create(&thread, NULL, run, this) == 0;  // Create thread
+    }
+    bool started = running;                              // Copy result under the lock
+    pthread_mutex_unlock(&lock);                         // Unlock state
+    return started;                                      // Return thread state
+}
+
+// Function to stop the sampling thread and wait for it to exit
+void DHTReader::stop() {
+    pthread_mutex_lock(&lock);                           // Lock state
+    if (!running) {                                      // Nothing to stop
+        pthread_mutex_unlock(&lock);                     // Unlock state
+        return;
+    }
+    running = false;                                     // Ask the thread to exit
+    pthread_cond_signal(&wake);                          // Interrupt its wait
+    pthread_mutex_unlock(&lock);                         // Unlock state
+    pthread_join(thread, NULL);                          // Wait for the thread
+}
+
+// Function to copy the last good values
+// Returns: false until the first good read
+bool DHTReader::read(double *humidity, double *temperature) {
+    pthread_mutex_lock(&lock);                           // Lock values
+    *humidity = this->humidity;                          // Copy humidity
+    *temperature = this->temperature;                    // Copy temperature
+    bool ok = valid;                                     // Copy validity
+    pthread_mutex_unlock(&lock);                         // Unlock values
+    return ok;                                           // Return validity
+}
+
+// Function to get the age of the last good values
+// Returns: age in ms, DHTREADER_AGE_NONE before the first good read
+unsigned int DHTReader::getAge() {
+    pthread_mutex_lock(&lock);                           // Lock values
+    unsigned int age = valid ? millis() - timestamp : DHTREADER_AGE_NONE;  // Compute age
+    pthread_mutex_unlock(&lock);                         // Unlock values
+    return age;                                          // Return age
+}
+
+// Function to get a copy of the counters
+DHTReaderStats DHTReader::getStats() {
+    pthread_mutex_lock(&lock);                           // Lock counters
+    DHTReaderStats copy = stats;                         // Copy counters
+    pthread_mutex_unlock(&lock);                         // Unlock counters
+    return copy;                                         // Return copy
+}
+
+void *DHTReader::run(void *arg) {
+    ((DHTReader *)arg)->loop();                          // Run the sampling loop
+    return NULL;
+}
+
+// Function to publish the result of one read
+void DHTReader::publish(int chk) {
+    pthread_mutex_lock(&lock);                           // Lock values and counters
+    if (chk == DHTLIB_OK) {                              // Good read
+        humidity = sensor.humidity;                      // Publish humidity
+        temperature = sensor.temperature;                // Publish temperature
+        timestamp = millis();                            // Remember sample time
+        valid = true;                                    // Values are usable
+        stats.reads++;                                   // Count good read
+        stats.consecutiveErrors = 0;                     // Reset error run
+    } else {
+        if (chk == DHTLIB_ERROR_CHECKSUM) {              // Checksum error
+            stats.checksumErrors++;
+        } else if (chk == DHTLIB_ERROR_TIMEOUT) {        // Timeout error
+            stats.timeoutErrors++;
+        } else {                                         // GPIO or unknown error
+            stats.otherErrors++;
+        }
+        stats.consecutiveErrors++;                       // Extend error run
+    }
+    pthread_mutex_unlock(&lock);                         // Unlock values and counters
+}
+
+// Function run by the sampling thread
+// A good read waits a full interval. A failed read is retried after
+// DHTREADER_RETRY_MIN ms, doubling on every further failure up to the interval.
+// Retries never come sooner than the sensor minimum: reading the DHT11 again
+// before it has recovered is what makes the next read fail.
+void DHTReader::loop() {
+    unsigned int wait = 0;                               // Delay before the next read in ms
+    unsigned int retry = DHTREADER_RETRY_MIN;            // Next retry delay in ms
+    struct timespec deadline;                            // Absolute wake time
+
+    pthread_mutex_lock(&lock);                           // Lock state
+    while (running) {                                    // Until stop()
+        clock_gettime(CLOCK_MONOTONIC, &deadline);       // Get current time
+        deadline.tv_sec += wait / 1000;                  // Add whole seconds
+        deadline.tv_nsec += (wait % 1000) * 1000000L;    // Add remaining ms
+        if (deadline.tv_nsec >= 1000000000L) {           // Normalize
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (running && pthread_cond_timedwait(&wake, &lock, &deadline) == 0);  // Sleep until due or stopped
+        if (!running) {                                  // Stopped while sleeping
+            break;
+        }
+        pthread_mutex_unlock(&lock);                     // Never hold the lock during a read
+
+        int chk = sensor.readDHT11Once(pin);             // Read sensor once
+        if (chk == DHTLIB_ERROR_GPIO) {                  // GPIO character device unavailable
+            sensor.setDecoder(DHTLIB_DECODER_POLLING);   // Fall back to the polling decoder
+        }
+        publish(chk);                                    // Publish result
+
+        if (chk == DHTLIB_OK) {                          // Good read
+            wait = interval;                             // Next sample after a full interval
+            retry = DHTREADER_RETRY_MIN;                 // Reset retry delay
+        } else {
+            wait = retry;                                // Retry soon
+            retry = retry * 2 > interval ? interval : retry * 2;  // Back off up to the interval
+        }
+        pthread_mutex_lock(&lock);                       // Lock state
+    }
+    pthread_mutex_unlock(&lock);                         // Unlock state
+}
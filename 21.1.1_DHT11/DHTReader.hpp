@@ -0,0 +1,54 @@
+/**********************************************************************
+* Filename    : DHTReader.hpp
+* Description : Non-blocking cached reader for the DHT class.
+*               Used for Raspberry Pi.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+**********************************************************************/
+#ifndef _DHTREADER_H_                        // Include guard to prevent multiple inclusions
+#define _DHTREADER_H_
+
+#include <pthread.h>                         // Include POSIX threads
+#include <stdint.h>                          // Include standard integer types
+#include "DHT.hpp"                           // Include DHT library
+
+#define DHTREADER_INTERVAL      1000         // Minimum sample interval of the DHT11 in ms
+#define DHTREADER_RETRY_MIN     DHTREADER_INTERVAL  // First retry delay in ms, a retry must also respect the sensor minimum
+#define DHTREADER_AGE_NONE      0xFFFFFFFF   // Sample age reported before the first good read
+
+// Snapshot of the reader counters
+struct DHTReaderStats {
+    uint32_t reads;                          // Successful reads
+    uint32_t checksumErrors;                 // Reads rejected by the checksum
+    uint32_t timeoutErrors;                  // Reads that timed out
+    uint32_t otherErrors;                    // GPIO or unknown errors
+    uint32_t consecutiveErrors;              // Errors since the last good read
+};
+
+class DHTReader {
+    public:
+        DHTReader(int pin, unsigned int interval = DHTREADER_INTERVAL);  // Constructor
+        ~DHTReader();                        // Destructor, stops the thread
+        bool start();                        // Start background sampling
+        void stop();                         // Stop background sampling
+        bool read(double *humidity, double *temperature);  // Get last good values, false before the first one
+        unsigned int getAge();               // Age in ms of the last good values
+        DHTReaderStats getStats();           // Get a copy of the counters
+    private:
+        DHT sensor;                          // Underlying sensor driver
+        int pin;                             // wiringPi pin of the sensor
+        unsigned int interval;               // Sample interval in ms
+        bool valid;                          // At least one good read published
+        bool running;                        // Thread is running
+        double humidity, temperature;        // Last good values
+        unsigned int timestamp;              // millis() of the last good values
+        DHTReaderStats stats;                // Counters
+        pthread_t thread;                    // Sampling thread
+        pthread_mutex_t lock;                // Protects published values and counters
+        pthread_cond_t wake;                 // Wakes the thread early on stop()
+        static void *run(void *arg);         // Thread entry point
+        void loop();                         // Sampling loop
+        void publish(int chk);               // Publish one read result
+};
+
+#endif                                        // End of include guard
@@ -0,0 +1,135 @@
+/*
+Filename    : MPU6050FusionTest.cpp
+Description : Check MPU6050Fusion accuracy against a reference dataset and measure its throughput
+Author      : Philippe Jos
+Modified    : 18/10/2026
+Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/25.1.1_MPU6050
+Build       : g++ -O2 -o MPU6050FusionTest MPU6050FusionTest.cpp ../MPU6050Fusion.cpp
+Run         : ./MPU6050FusionTest [MPU6050FusionData.txt]
+*/
+#include <stdio.h>                                      // Include standard I/O library
+#include <stdint.h>                                     // Include standard integer types
+#include <math.h>                                       // Include math functions
+#include <time.h>                                       // Include clock_gettime()
+#include "../MPU6050Fusion.h"                           // Include the fusion filters under test
+
+#define DATA_FILE           "MPU6050FusionData.txt"     // Default dataset
+#define DATA_RATE           200.0f                      // Sample rate of the dataset in Hz
+#define DATA_MAX_SAMPLES    4096                        // Dataset capacity
+#define SETTLE_SAMPLES      400                         // Errors are checked after 2 s of convergence
+#define TILT_ERROR_MAX      2.0                         // Largest allowed tilt error in degrees
+#define YAW_ERROR_MAX       5.0                         // Largest allowed yaw error in degrees (no magnetometer, gyro bias drifts)
+#define BENCH_RATE          1000.0f                     // Input rate the filters must keep up with
+#define BENCH_PASSES        200                         // Dataset replays for the throughput measurement
+#define BENCH_LOAD_MAX      10.0                        // Largest allowed share of one core at 1 kHz in percent
+
+MPU6050Sample samples[DATA_MAX_SAMPLES];                // Raw samples of the dataset
+float reference[DATA_MAX_SAMPLES][4];                   // Reference quaternion w x y z
+bool hasReference[DATA_MAX_SAMPLES];                    // The line carried a reference quaternion
+uint32_t sampleCount = 0;                               // Samples loaded
+
+// Function to load the dataset: 6 raw values per line, some lines followed by a reference quaternion
+bool loadData(const char *path) {
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        perror(path);                                   // Print error message
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), in) && sampleCount < DATA_MAX_SAMPLES) {
+        if (line[0] == '#') continue;                   // Skip comments
+        MPU6050Sample *s = &samples[sampleCount];
+        float *q = reference[sampleCount];
+        int n = sscanf(line, "%hd %hd %hd %hd %hd %hd %f %f %f %f",
+                       &s->ax, &s->ay, &s->az, &s->gx, &s->gy, &s->gz, &q[0], &q[1], &q[2], &q[3]);
+        if (n != 6 && n != 10) continue;                // Skip malformed lines
+        s->timestamp = (uint64_t)(sampleCount * (1e9 / DATA_RATE));
+        hasReference[sampleCount] = n == 10;
+        sampleCount++;
+    }
+    fclose(in);
+    return sampleCount > SETTLE_SAMPLES;
+}
+
+// Function to get the angle in degrees between the gravity directions of two orientations
+double tiltError(const float *a, const float *b) {
+    // third row of the rotation matrix: earth z axis seen from the sensor
+    double ax = 2.0 * (a[1] * a[3] - a[0] * a[2]), ay = 2.0 * (a[0] * a[1] + a[2] * a[3]), az = a[0] * a[0] - a[1] * a[1] - a[2] * a[2] + a[3] * a[3];
+    double bx = 2.0 * (b[1] * b[3] - b[0] * b[2]), by = 2.0 * (b[0] * b[1] + b[2] * b[3]), bz = b[0] * b[0] - b[1] * b[1] - b[2] * b[2] + b[3] * b[3];
+    double dot = (ax * bx + ay * by + az * bz) / sqrt((ax * ax + ay * ay + az * az) * (bx * bx + by * by + bz * bz));
+    return acos(dot > 1.0 ? 1.0 : dot) * 180.0 / M_PI;
+}
+
+// Function to get the heading difference in degrees, wrapped to -180..180
+double yawError(const float *a, const float *b) {
+    double yawA = atan2(2.0 * (a[1] * a[2] + a[0] * a[3]), a[0] * a[0] + a[1] * a[1] - a[2] * a[2] - a[3] * a[3]);
+    double yawB = atan2(2.0 * (b[1] * b[2] + b[0] * b[3]), b[0] * b[0] + b[1] * b[1] - b[2] * b[2] - b[3] * b[3]);
+    double d = (yawA - yawB) * 180.0 / M_PI;
+    while (d > 180.0) d -= 360.0;
+    while (d < -180.0) d += 360.0;
+    return d;
+}
+
+// Function to replay the dataset through one filter and check its errors against the reference
+bool checkAccuracy(uint8_t algorithm, const char *name) {
+    MPU6050Fusion fusion(algorithm, DATA_RATE);
+    double tiltMax = 0, tiltSum = 0, yawMax = 0;
+    uint32_t checked = 0;
+    uint32_t start = 0;
+    for (uint32_t i = 0; i < sampleCount; i++) {
+        if (!hasReference[i]) continue;
+        fusion.update(&samples[start], i + 1 - start);  // Feed the batch up to this reference
+        start = i + 1;
+        if (i < SETTLE_SAMPLES) continue;
+        float q[4];
+        fusion.getQuaternion(&q[0], &q[1], &q[2], &q[3]);
+        double tilt = tiltError(q, reference[i]);
+        double yaw = fabs(yawError(q, reference[i]));
+        if (tilt > tiltMax) tiltMax = tilt;
+        if (yaw > yawMax) yawMax = yaw;
+        tiltSum += tilt * tilt;
+        checked++;
+    }
+    bool pass = checked > 0 && tiltMax <= TILT_ERROR_MAX && yawMax <= YAW_ERROR_MAX;
+    printf("%-8s tilt rms %5.2f max %5.2f deg (limit %.1f), yaw max %5.2f deg (limit %.1f), %u points: %s\n",
+           name, sqrt(tiltSum / (checked > 0 ? checked : 1)), tiltMax, TILT_ERROR_MAX, yawMax, YAW_ERROR_MAX,
+           checked, pass ? "PASS" : "FAIL");
+    return pass;
+}
+
+// Function to measure the filter cost per sample and the core load it means at 1 kHz
+bool checkThroughput(uint8_t algorithm, const char *name) {
+    MPU6050Fusion fusion(algorithm, BENCH_RATE);
+    struct timespec begin, end;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        fusion.update(samples, sampleCount);            // Same data as the accuracy check, replayed as 1 kHz input
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    float q[4];
+    fusion.getQuaternion(&q[0], &q[1], &q[2], &q[3]);   // Keep the result live
+    double ns = ((end.tv_sec - begin.tv_sec) * 1e9 + (end.tv_nsec - begin.tv_nsec)) / ((double)BENCH_PASSES * sampleCount);
+    double load = ns * BENCH_RATE / 1e9 * 100.0;        // Share of one core at 1 kHz input
+    bool pass = load <= BENCH_LOAD_MAX && q[0] == q[0];
+    printf("%-8s %7.1f ns/sample, %.4f%% of a core at 1 kHz (limit %.0f%%): %s\n",
+           name, ns, load, BENCH_LOAD_MAX, pass ? "PASS" : "FAIL");
+    return pass;
+}
+
+// Main function to run every check, returns 0 when all pass
+int main(int argc, char *argv[]) {
+    const char *path = argc > 1 ? argv[1] : DATA_FILE;
+    if (!loadData(path)) {
+        printf("Failed to load %s\n", path);            // Print error message
+        return 1;
+    }
+    printf("Loaded %u samples from %s\n", sampleCount, path);
+
+    bool pass = true;
+    pass &= checkAccuracy(MPU6050_FUSION_MADGWICK, "Madgwick");
+    pass &= checkAccuracy(MPU6050_FUSION_MAHONY, "Mahony");
+    pass &= checkThroughput(MPU6050_FUSION_MADGWICK, "Madgwick");
+    pass &= checkThroughput(MPU6050_FUSION_MAHONY, "Mahony");
+    printf("%s\n", pass ? "All checks passed" : "Some checks failed");
+    return pass ? 0 : 1;
+}
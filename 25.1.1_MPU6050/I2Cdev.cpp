@@ -51,15 +51,113 @@ THE SOFTWARE.
 #include <sys/ioctl.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <pthread.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
+#include <time.h>
 #include "I2Cdev.h"
 
+static I2Cbus *busList = NULL;
+static pthread_mutex_t busListLock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/** Create a handle for one I2C bus.
+ * The bus device is opened lazily, once per slave address, on first access.
+ * Each bus has its own lock, so devices on different buses can be driven from
+ * different threads in parallel.
+ * @param path Bus character device, e.g. "/dev/i2c-3" or an i2c-gpio software bus
+ */
+I2Cbus::I2Cbus(const char *path) {
+    strncpy(this->path, path, sizeof(this->path) - 1);
+    this->path[sizeof(this->path) - 1] = 0;
+    for (int i = 0; i < 128; i++) {
+        fd[i] = -1;
+        stats[i] = NULL;
+    }
+    contended = 0;
+    waitNs = 0;
+    pthread_mutex_init(&lock, NULL);
+
+    pthread_mutex_lock(&busListLock);
+    next = busList;
+    busList = this;
+    pthread_mutex_unlock(&busListLock);
+}
+
+I2Cbus::~I2Cbus() {
+    pthread_mutex_lock(&busListLock);
+    for (I2Cbus **b = &busList; *b; b = &(*b)->next) {
+        if (*b == this) {
+            *b = next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&busListLock);
+
+    for (int i = 0; i < 128; i++) {
+        if (fd[i] >= 0) close(fd[i]);
+        if (!stats[i]) continue;
+        for (int r = 0; r < 256; r++) free(stats[i][r]);
+        free(stats[i]);
+    }
+    pthread_mutex_destroy(&lock);
+}
+
+/** Get the bus character device path.
+ * @return Path given to the constructor
+ */
+const char *I2Cbus::getPath() {
+    return path;
+}
+
+/** Get the cached bus descriptor for a device, opening it on first use.
+ * Each descriptor stays open with I2C_SLAVE already set, so a register access
+ * costs only the transfer itself. Must be called with lock held.
+ * @param devAddr I2C slave device address
+ * @return File descriptor with the slave address set, -1 on failure
+ */
+int I2Cbus::getDeviceFd(uint8_t devAddr) {
+    devAddr &= 0x7F;
+    if (fd[devAddr] >= 0) return fd[devAddr];
+
+    int f = open(path, O_RDWR | O_CLOEXEC);
+    if (f < 0) {
+        fprintf(stderr, "Failed to open device %s: %s\n", path, strerror(errno));
+        return(-1);
+    }
+    if (ioctl(f, I2C_SLAVE, devAddr) < 0) {
+        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
+        close(f);
+        return(-1);
+    }
+    fd[devAddr] = f;
+    return f;
+}
+
+/** Close and forget the cached bus descriptor for a device.
+ * An entry is dropped on any error so the next access reopens the bus.
+ * Must be called with lock held.
+ * @param devAddr I2C slave device address
+ */
+void I2Cbus::dropDeviceFd(uint8_t devAddr) {
+    devAddr &= 0x7F;
+    if (fd[devAddr] < 0) return;
+    close(fd[devAddr]);
+    fd[devAddr] = -1;
+}
+
 /** Default constructor.
  */
 I2Cdev::I2Cdev() {
 }
 
 /** Read a single bit from an 8-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param bitNum Bit position to read (0-7)
@@ -67,14 +165,15 @@ I2Cdev::I2Cdev() {
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBit(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
     uint8_t b;
-    uint8_t count = readByte(devAddr, regAddr, &b, timeout);
+    uint8_t count = readByte(bus, devAddr, regAddr, &b, timeout);
     *data = b & (1 << bitNum);
     return count;
 }
 
 /** Read a single bit from a 16-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param bitNum Bit position to read (0-15)
@@ -82,14 +181,15 @@ int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBitW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
     uint16_t b;
-    uint8_t count = readWord(devAddr, regAddr, &b, timeout);
+    uint8_t count = readWord(bus, devAddr, regAddr, &b, timeout);
     *data = b & (1 << bitNum);
     return count;
 }
 
 /** Read multiple bits from an 8-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param bitStart First bit position to read (0-7)
@@ -98,14 +198,14 @@ int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBits(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
     // 01101001 read byte
     // 76543210 bit numbers
     //    xxx   args: bitStart=4, length=3
     //    010   masked
     //   -> 010 shifted
     uint8_t count, b;
-    if ((count = readByte(devAddr, regAddr, &b, timeout)) != 0) {
+    if ((count = readByte(bus, devAddr, regAddr, &b, timeout)) != 0) {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         b &= mask;
         b >>= (bitStart - length + 1);
@@ -115,6 +215,7 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
 }
 
 /** Read multiple bits from a 16-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param bitStart First bit position to read (0-15)
@@ -123,7 +224,7 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBitsW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
     // 1101011001101001 read byte
     // fedcba9876543210 bit numbers
     //    xxx           args: bitStart=12, length=3
@@ -131,7 +232,7 @@ int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uin
     //           -> 010 shifted
     uint8_t count;
     uint16_t w;
-    if ((count = readWord(devAddr, regAddr, &w, timeout)) != 0) {
+    if ((count = readWord(bus, devAddr, regAddr, &w, timeout)) != 0) {
         uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         w &= mask;
         w >>= (bitStart - length + 1);
@@ -141,28 +242,31 @@ int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uin
 }
 
 /** Read single byte from an 8-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param data Container for byte value read from device
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
-    return readBytes(devAddr, regAddr, 1, data, timeout);
+int8_t I2Cdev::readByte(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
+    return readBytes(bus, devAddr, regAddr, 1, data, timeout);
 }
 
 /** Read single word from a 16-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param data Container for word value read from device
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
-    return readWords(devAddr, regAddr, 1, data, timeout);
+int8_t I2Cdev::readWord(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
+    return readWords(bus, devAddr, regAddr, 1, data, timeout);
 }
 
 /** Read multiple bytes from an 8-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
  * @param length Number of bytes to read
@@ -170,40 +274,58 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Number of bytes read (-1 indicates failure)
  */
-int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-    int8_t count = 0;
-    int fd = open("/dev/i2c-1", O_RDWR);
+int8_t I2Cdev::readBytes(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    lockBus(bus);
+    int8_t count = readBytesLocked(bus, devAddr, regAddr, length, data);
+    pthread_mutex_unlock(&bus->lock);
+    return count;
+}
 
+/** Read multiple bytes with the bus lock already held.
+ * @param bus Bus the device is on, locked by the caller
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int8_t I2Cdev::readBytesLocked(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    struct i2c_msg msgs[2];
+    struct i2c_rdwr_ioctl_data packets;
+
+    // Register pointer write and data read go out as one I2C_RDWR transaction
+    // with a repeated start in between: one syscall, no STOP for another bus
+    // master to slip into
+    msgs[0].addr = devAddr;
+    msgs[0].flags = 0;
+    msgs[0].len = 1;
+    msgs[0].buf = &regAddr;
+    msgs[1].addr = devAddr;
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].len = length;
+    msgs[1].buf = data;
+    packets.msgs = msgs;
+    packets.nmsgs = 2;
+
+    int fd = bus->getDeviceFd(devAddr);
     if (fd < 0) {
-        fprintf(stderr, "Failed to open device: %s\n", strerror(errno));
-        return(-1);
-    }
-    if (ioctl(fd, I2C_SLAVE, devAddr) < 0) {
-        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
-        close(fd);
         return(-1);
     }
-    if (write(fd, &regAddr, 1) != 1) {
-        fprintf(stderr, "Failed to write reg: %s\n", strerror(errno));
-        close(fd);
+    uint64_t start = statsEnabled ? monotonicNs() : 0;
+    if (ioctl(fd, I2C_RDWR, &packets) != 2) {
+        int error = errno;
+        if (statsEnabled) recordStats(bus, devAddr, regAddr, start, 0, error);
+        fprintf(stderr, "Failed to read device: %s\n", strerror(error));
+        bus->dropDeviceFd(devAddr);
         return(-1);
     }
-    count = read(fd, data, length);
-    if (count < 0) {
-        fprintf(stderr, "Failed to read device(%d): %s\n", count, ::strerror(errno));
-        close(fd);
-        return(-1);
-    } else if (count != length) {
-        fprintf(stderr, "Short read  from device, expected %d, got %d\n", length, count);
-        close(fd);
-        return(-1);
-    }
-    close(fd);
+    if (statsEnabled) recordStats(bus, devAddr, regAddr, start, length, 0);
 
-    return count;
+    return length;
 }
 
 /** Read multiple words from a 16-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
  * @param length Number of words to read
@@ -211,7 +333,7 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Number of words read (0 indicates failure)
  */
-int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
+int8_t I2Cdev::readWords(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
     int8_t count = 0;
 
     printf("ReadWords() not implemented\n");
@@ -222,34 +344,55 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
 }
 
 /** write a single bit in an 8-bit device register.
+ * The read and the write happen under one hold of the bus lock, so threads
+ * updating other bits of the same register do not lose each other's change.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
  * @param bitNum Bit position to write (0-7)
  * @param value New bit value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-    uint8_t b;
-    readByte(devAddr, regAddr, &b);
-    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    return writeByte(devAddr, regAddr, b);
+bool I2Cdev::writeBit(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+    uint8_t buf[2];
+    lockBus(bus);
+    if (readBytesLocked(bus, devAddr, regAddr, 1, &buf[1]) < 0) {
+        pthread_mutex_unlock(&bus->lock);
+        return false;
+    }
+    buf[0] = regAddr;
+    buf[1] = (data != 0) ? (buf[1] | (1 << bitNum)) : (buf[1] & ~(1 << bitNum));
+    bool status = writeBufferLocked(bus, devAddr, buf, 2);
+    pthread_mutex_unlock(&bus->lock);
+    return status;
 }
 
 /** write a single bit in a 16-bit device register.
+ * The read and the write happen under one hold of the bus lock.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
  * @param bitNum Bit position to write (0-15)
  * @param value New bit value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
+bool I2Cdev::writeBitW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
     uint16_t w;
-    readWord(devAddr, regAddr, &w);
+    uint8_t buf[3];
+    lockBus(bus);
+    readWord(bus, devAddr, regAddr, &w); // readWords() does not access the bus, safe under the lock
     w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
-    return writeWord(devAddr, regAddr, w);
+    buf[0] = regAddr;
+    buf[1] = w >> 8;
+    buf[2] = w;
+    bool status = writeBufferLocked(bus, devAddr, buf, 3);
+    pthread_mutex_unlock(&bus->lock);
+    return status;
 }
 
 /** Write multiple bits in an 8-bit device register.
+ * The read and the write happen under one hold of the bus lock.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
  * @param bitStart First bit position to write (0-7)
@@ -257,7 +400,7 @@ bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_
  * @param data Right-aligned value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+bool I2Cdev::writeBits(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
     //      010 value to write
     // 76543210 bit numbers
     //    xxx   args: bitStart=4, length=3
@@ -266,19 +409,24 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     // 10100011 original & ~mask
     // 10101011 masked | value
     uint8_t b;
-    if (readByte(devAddr, regAddr, &b) != 0) {
+    bool status = false;
+    lockBus(bus);
+    if (readBytesLocked(bus, devAddr, regAddr, 1, &b) > 0) {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         data <<= (bitStart - length + 1); // shift data into correct position
         data &= mask; // zero all non-important bits in data
         b &= ~(mask); // zero all important bits in existing byte
         b |= data; // combine data with existing byte
-        return writeByte(devAddr, regAddr, b);
-    } else {
-        return false;
+        uint8_t buf[2] = {regAddr, b};
+        status = writeBufferLocked(bus, devAddr, buf, 2);
     }
+    pthread_mutex_unlock(&bus->lock);
+    return status;
 }
 
 /** Write multiple bits in a 16-bit device register.
+ * The read and the write happen under one hold of the bus lock.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
  * @param bitStart First bit position to write (0-15)
@@ -286,7 +434,7 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @param data Right-aligned value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
+bool I2Cdev::writeBitsW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
     //              010 value to write
     // fedcba9876543210 bit numbers
     //    xxx           args: bitStart=12, length=3
@@ -295,93 +443,75 @@ bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
     // 1010001110010110 original & ~mask
     // 1010101110010110 masked | value
     uint16_t w;
-    if (readWord(devAddr, regAddr, &w) != 0) {
+    bool status = false;
+    lockBus(bus);
+    if (readWord(bus, devAddr, regAddr, &w) != 0) { // readWords() does not access the bus, safe under the lock
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         data <<= (bitStart - length + 1); // shift data into correct position
         data &= mask; // zero all non-important bits in data
         w &= ~(mask); // zero all important bits in existing word
         w |= data; // combine data with existing word
-        return writeWord(devAddr, regAddr, w);
-    } else {
-        return false;
+        uint8_t buf[3] = {regAddr, (uint8_t)(w >> 8), (uint8_t)w};
+        status = writeBufferLocked(bus, devAddr, buf, 3);
     }
+    pthread_mutex_unlock(&bus->lock);
+    return status;
 }
 
 /** Write single byte to an 8-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param data New byte value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
-    return writeBytes(devAddr, regAddr, 1, &data);
+bool I2Cdev::writeByte(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t data) {
+    return writeBytes(bus, devAddr, regAddr, 1, &data);
 }
 
 /** Write single word to a 16-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param data New word value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
-    return writeWords(devAddr, regAddr, 1, &data);
+bool I2Cdev::writeWord(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t data) {
+    return writeWords(bus, devAddr, regAddr, 1, &data);
 }
 
 /** Write multiple bytes to an 8-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr First register address to write to
  * @param length Number of bytes to write
  * @param data Buffer to copy new data from
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
-    int8_t count = 0;
+bool I2Cdev::writeBytes(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
     uint8_t buf[128];
-    int fd;
 
     if (length > 127) {
         fprintf(stderr, "Byte write count (%d) > 127\n", length);
         return(FALSE);
     }
 
-    fd = open("/dev/i2c-1", O_RDWR);
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open device: %s\n", strerror(errno));
-        return(FALSE);
-    }
-    if (ioctl(fd, I2C_SLAVE, devAddr) < 0) {
-        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
-        close(fd);
-        return(FALSE);
-    }
     buf[0] = regAddr;
     memcpy(buf+1,data,length);
-    count = write(fd, buf, length+1);
-    if (count < 0) {
-        fprintf(stderr, "Failed to write device(%d): %s\n", count, ::strerror(errno));
-        close(fd);
-        return(FALSE);
-    } else if (count != length+1) {
-        fprintf(stderr, "Short write to device, expected %d, got %d\n", length+1, count);
-        close(fd);
-        return(FALSE);
-    }
-    close(fd);
-
-    return TRUE;
+    return writeBuffer(bus, devAddr, buf, length+1);
 }
 
 /** Write multiple words to a 16-bit device register.
+ * @param bus Bus the device is on
  * @param devAddr I2C slave device address
  * @param regAddr First register address to write to
  * @param length Number of words to write
  * @param data Buffer to copy new data from
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
-    int8_t count = 0;
+bool I2Cdev::writeWords(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
     uint8_t buf[128];
-    int i, fd;
+    int i;
 
     // Should do potential byteswap and call writeBytes() really, but that
     // messes with the callers buffer
@@ -391,35 +521,428 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         return(FALSE);
     }
 
-    fd = open("/dev/i2c-1", O_RDWR);
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open device: %s\n", strerror(errno));
-        return(FALSE);
-    }
-    if (ioctl(fd, I2C_SLAVE, devAddr) < 0) {
-        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
-        close(fd);
-        return(FALSE);
-    }
     buf[0] = regAddr;
     for (i = 0; i < length; i++) {
         buf[i*2+1] = data[i] >> 8;
         buf[i*2+2] = data[i];
     }
-    count = write(fd, buf, length*2+1);
+    return writeBuffer(bus, devAddr, buf, length*2+1);
+}
+
+/** Write a prepared register address + payload buffer to a device.
+ * @param bus Bus the device is on
+ * @param devAddr I2C slave device address
+ * @param buf Register address followed by the data bytes
+ * @param length Total number of bytes in buf
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBuffer(I2Cbus *bus, uint8_t devAddr, const uint8_t *buf, uint8_t length) {
+    lockBus(bus);
+    bool status = writeBufferLocked(bus, devAddr, buf, length);
+    pthread_mutex_unlock(&bus->lock);
+    return status;
+}
+
+/** Write a prepared buffer with the bus lock already held.
+ * @param bus Bus the device is on, locked by the caller
+ * @param devAddr I2C slave device address
+ * @param buf Register address followed by the data bytes
+ * @param length Total number of bytes in buf
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBufferLocked(I2Cbus *bus, uint8_t devAddr, const uint8_t *buf, uint8_t length) {
+    int8_t count = 0;
+
+    int fd = bus->getDeviceFd(devAddr);
+    if (fd < 0) {
+        return(FALSE);
+    }
+    uint64_t start = statsEnabled ? monotonicNs() : 0;
+    count = write(fd, buf, length);
+    int error = count < 0 ? errno : (count != length ? EIO : 0);
+    if (statsEnabled) recordStats(bus, devAddr, buf[0], start, error ? 0 : length - 1, error);
     if (count < 0) {
-        fprintf(stderr, "Failed to write device(%d): %s\n", count, ::strerror(errno));
-        close(fd);
+        fprintf(stderr, "Failed to write device(%d): %s\n", count, ::strerror(error));
+        bus->dropDeviceFd(devAddr);
         return(FALSE);
-    } else if (count != length*2+1) {
-        fprintf(stderr, "Short write to device, expected %d, got %d\n", length+1, count);
-        close(fd);
+    } else if (count != length) {
+        fprintf(stderr, "Short write to device, expected %d, got %d\n", length, count);
+        bus->dropDeviceFd(devAddr);
         return(FALSE);
     }
-    close(fd);
+
     return TRUE;
 }
 
+/** Close the cached bus descriptor of a device.
+ * The next access reopens the bus and selects the device again. Call this after
+ * changing the device's address or when the bus was reset underneath us.
+ * @param bus Bus the device is on
+ * @param devAddr I2C slave device address
+ */
+void I2Cdev::closeDevice(I2Cbus *bus, uint8_t devAddr) {
+    lockBus(bus);
+    bus->dropDeviceFd(devAddr);
+    pthread_mutex_unlock(&bus->lock);
+}
+
+/** Get the bus used by the overloads without a bus argument.
+ * Created on first use, so it is valid during static initialization.
+ * @return Handle for /dev/i2c-1, the header bus of every Raspberry Pi since the B+
+ */
+I2Cbus *I2Cdev::getDefaultBus() {
+    static I2Cbus defaultBus(I2CDEV_DEFAULT_BUS);
+    return &defaultBus;
+}
+
+// Overloads on the default bus, for code written against the original all-static API
+
+int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+    return readBit(getDefaultBus(), devAddr, regAddr, bitNum, data, timeout);
+}
+
+int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
+    return readBitW(getDefaultBus(), devAddr, regAddr, bitNum, data, timeout);
+}
+
+int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+    return readBits(getDefaultBus(), devAddr, regAddr, bitStart, length, data, timeout);
+}
+
+int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
+    return readBitsW(getDefaultBus(), devAddr, regAddr, bitStart, length, data, timeout);
+}
+
+int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
+    return readByte(getDefaultBus(), devAddr, regAddr, data, timeout);
+}
+
+int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
+    return readWord(getDefaultBus(), devAddr, regAddr, data, timeout);
+}
+
+int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    return readBytes(getDefaultBus(), devAddr, regAddr, length, data, timeout);
+}
+
+int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
+    return readWords(getDefaultBus(), devAddr, regAddr, length, data, timeout);
+}
+
+bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+    return writeBit(getDefaultBus(), devAddr, regAddr, bitNum, data);
+}
+
+bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
+    return writeBitW(getDefaultBus(), devAddr, regAddr, bitNum, data);
+}
+
+bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+    return writeBits(getDefaultBus(), devAddr, regAddr, bitStart, length, data);
+}
+
+bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
+    return writeBitsW(getDefaultBus(), devAddr, regAddr, bitStart, length, data);
+}
+
+bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
+    return writeByte(getDefaultBus(), devAddr, regAddr, data);
+}
+
+bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
+    return writeWord(getDefaultBus(), devAddr, regAddr, data);
+}
+
+bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    return writeBytes(getDefaultBus(), devAddr, regAddr, length, data);
+}
+
+bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
+    return writeWords(getDefaultBus(), devAddr, regAddr, length, data);
+}
+
+void I2Cdev::closeDevice(uint8_t devAddr) {
+    closeDevice(getDefaultBus(), devAddr);
+}
+
+// Transaction statistics
+
+bool I2Cdev::statsEnabled = false;
+
+static pthread_t snapshotThread;
+static bool snapshotRunning = false;
+static pthread_mutex_t snapshotLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t snapshotWake;
+static char snapshotPath[256];
+static uint32_t snapshotIntervalMs;
+
+/** Map a latency to its histogram bucket.
+ * Latencies are counted in 1.024 us units; each power of two is split in four
+ * linear sub-buckets, so every bucket is within 25% of its neighbours, in the
+ * spirit of HdrHistogram with two significant bits.
+ */
+static uint8_t latencyBucket(uint64_t ns) {
+    uint64_t units = ns >> 10;
+    if (units < 4) return units;
+    uint8_t magnitude = 63 - __builtin_clzll(units);
+    uint32_t bucket = (magnitude - 1) * 4 + ((units >> (magnitude - 2)) & 3);
+    return bucket < I2CDEV_STATS_BUCKETS ? bucket : I2CDEV_STATS_BUCKETS - 1;
+}
+
+/** Upper latency bound of a histogram bucket.
+ * @return Nanoseconds
+ */
+static uint64_t bucketLimitNs(uint8_t bucket) {
+    bucket++;
+    if (bucket < 4) return (uint64_t)bucket << 10;
+    uint8_t magnitude = bucket / 4 + 1;
+    return ((uint64_t)(4 + bucket % 4) << (magnitude - 2)) << 10;
+}
+
+/** Latency below which a fraction of the transactions completed.
+ * @return Nanoseconds, capped at the observed maximum
+ */
+static uint64_t percentileNs(const I2CdevStats *s, double fraction) {
+    uint64_t target = (uint64_t)(s->count * fraction + 0.999999);
+    uint64_t seen = 0;
+    if (target == 0) target = 1;
+    for (uint8_t b = 0; b < I2CDEV_STATS_BUCKETS; b++) {
+        seen += s->histogram[b];
+        if (seen >= target) {
+            uint64_t limit = bucketLimitNs(b);
+            return limit < s->maxNs ? limit : s->maxNs;
+        }
+    }
+    return s->maxNs;
+}
+
+/** Take the bus lock, accounting the wait when statistics are on.
+ * @param bus Bus to lock
+ */
+void I2Cdev::lockBus(I2Cbus *bus) {
+    if (!statsEnabled) {
+        pthread_mutex_lock(&bus->lock);
+        return;
+    }
+    if (pthread_mutex_trylock(&bus->lock) == 0) return;
+    uint64_t start = monotonicNs();
+    pthread_mutex_lock(&bus->lock);
+    bus->contended++;
+    bus->waitNs += monotonicNs() - start;
+}
+
+/** Account one transaction. Must be called with the bus lock held.
+ * @param bus Bus of the transaction
+ * @param devAddr I2C slave device address
+ * @param regAddr Register the transaction started at
+ * @param startNs CLOCK_MONOTONIC time the transfer was issued
+ * @param bytes Payload bytes moved
+ * @param error errno of the failure, 0 on success
+ */
+void I2Cdev::recordStats(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint64_t startNs, uint32_t bytes, int error) {
+    uint64_t ns = monotonicNs() - startNs;
+    devAddr &= 0x7F;
+
+    if (!bus->stats[devAddr]) {
+        bus->stats[devAddr] = (I2CdevStats **)calloc(256, sizeof(I2CdevStats *));
+        if (!bus->stats[devAddr]) return;
+    }
+    I2CdevStats *s = bus->stats[devAddr][regAddr];
+    if (!s) {
+        s = bus->stats[devAddr][regAddr] = (I2CdevStats *)calloc(1, sizeof(I2CdevStats));
+        if (!s) return;
+    }
+
+    if (ns > UINT32_MAX) ns = UINT32_MAX;
+    if (s->count == 0 || ns < s->minNs) s->minNs = ns;
+    if (ns > s->maxNs) s->maxNs = ns;
+    s->count++;
+    s->totalNs += ns;
+    s->bytes += bytes;
+    s->histogram[latencyBucket(ns)]++;
+    if (error) {
+        s->errors++;
+        // bcm2835 reports a missing ACK as EREMOTEIO, other controllers as ENXIO
+        if (error == EREMOTEIO || error == ENXIO) s->naks++;
+    }
+}
+
+/** Turn transaction statistics on or off for all buses.
+ * When off, a transfer pays for one predictable branch. When on, it pays for
+ * two clock reads and a histogram update under the bus lock it already holds.
+ * Counters are kept when statistics are turned off.
+ * @param enabled New state
+ */
+void I2Cdev::enableStats(bool enabled) {
+    statsEnabled = enabled;
+}
+
+/** Zero all counters and histograms of all buses.
+ */
+void I2Cdev::resetStats() {
+    pthread_mutex_lock(&busListLock);
+    for (I2Cbus *bus = busList; bus; bus = bus->next) {
+        pthread_mutex_lock(&bus->lock);
+        for (int a = 0; a < 128; a++) {
+            if (!bus->stats[a]) continue;
+            for (int r = 0; r < 256; r++) {
+                if (bus->stats[a][r]) memset(bus->stats[a][r], 0, sizeof(I2CdevStats));
+            }
+        }
+        bus->contended = 0;
+        bus->waitNs = 0;
+        pthread_mutex_unlock(&bus->lock);
+    }
+    pthread_mutex_unlock(&busListLock);
+}
+
+/** Print a table of every (bus, address, register) seen, plus lock contention.
+ * @param out Stream to print to, e.g. stderr
+ */
+void I2Cdev::dumpStats(FILE *out) {
+    fprintf(out, "%-12s %4s %4s %9s %7s %7s %10s %9s %9s %9s %9s\n",
+            "bus", "addr", "reg", "count", "errors", "naks", "bytes", "avg us", "p50 us", "p99 us", "max us");
+    pthread_mutex_lock(&busListLock);
+    for (I2Cbus *bus = busList; bus; bus = bus->next) {
+        pthread_mutex_lock(&bus->lock);
+        for (int a = 0; a < 128; a++) {
+            if (!bus->stats[a]) continue;
+            for (int r = 0; r < 256; r++) {
+                const I2CdevStats *s = bus->stats[a][r];
+                if (!s || s->count == 0) continue;
+                fprintf(out, "%-12s 0x%02x 0x%02x %9u %7u %7u %10llu %9.1f %9.1f %9.1f %9.1f\n",
+                        bus->path, a, r, s->count, s->errors, s->naks, (unsigned long long)s->bytes,
+                        s->totalNs / 1000.0 / s->count, percentileNs(s, 0.5) / 1000.0,
+                        percentileNs(s, 0.99) / 1000.0, s->maxNs / 1000.0);
+            }
+        }
+        if (bus->contended) {
+            fprintf(out, "%-12s lock contended %u times, %.1f us waited\n", bus->path, bus->contended, bus->waitNs / 1000.0);
+        }
+        pthread_mutex_unlock(&bus->lock);
+    }
+    pthread_mutex_unlock(&busListLock);
+}
+
+/** Write all statistics as one line of JSON.
+ * The line holds a CLOCK_REALTIME timestamp, one object per bus with its lock
+ * contention, and one object per (address, register) with the raw counters,
+ * percentiles and the non-empty histogram buckets as [upper bound ns, count].
+ * @param out Stream to write to
+ */
+void I2Cdev::snapshotStats(FILE *out) {
+    struct timespec now;
+    bool firstBus = true;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    fprintf(out, "{\"time\":%lld.%03ld,\"buses\":[", (long long)now.tv_sec, now.tv_nsec / 1000000);
+    pthread_mutex_lock(&busListLock);
+    for (I2Cbus *bus = busList; bus; bus = bus->next) {
+        bool firstDevice = true;
+        pthread_mutex_lock(&bus->lock);
+        fprintf(out, "%s{\"bus\":\"%s\",\"contended\":%u,\"wait_ns\":%llu,\"registers\":[",
+                firstBus ? "" : ",", bus->path, bus->contended, (unsigned long long)bus->waitNs);
+        for (int a = 0; a < 128; a++) {
+            if (!bus->stats[a]) continue;
+            for (int r = 0; r < 256; r++) {
+                const I2CdevStats *s = bus->stats[a][r];
+                if (!s || s->count == 0) continue;
+                fprintf(out, "%s{\"addr\":%d,\"reg\":%d,\"count\":%u,\"errors\":%u,\"naks\":%u,\"bytes\":%llu,"
+                        "\"total_ns\":%llu,\"min_ns\":%u,\"max_ns\":%u,\"p50_ns\":%llu,\"p99_ns\":%llu,\"histogram\":[",
+                        firstDevice ? "" : ",", a, r, s->count, s->errors, s->naks, (unsigned long long)s->bytes,
+                        (unsigned long long)s->totalNs, s->minNs, s->maxNs,
+                        (unsigned long long)percentileNs(s, 0.5), (unsigned long long)percentileNs(s, 0.99));
+                bool firstBucket = true;
+                for (uint8_t b = 0; b < I2CDEV_STATS_BUCKETS; b++) {
+                    if (!s->histogram[b]) continue;
+                    fprintf(out, "%s[%llu,%u]", firstBucket ? "" : ",", (unsigned long long)bucketLimitNs(b), s->histogram[b]);
+                    firstBucket = false;
+                }
+                fprintf(out, "]}");
+                firstDevice = false;
+            }
+        }
+        fprintf(out, "]}");
+        pthread_mutex_unlock(&bus->lock);
+        firstBus = false;
+    }
+    pthread_mutex_unlock(&busListLock);
+    fprintf(out, "]}\n");
+    fflush(out);
+}
+
+static void *snapshotRun(void *arg) {
+    struct timespec deadline;
+
+    (void)arg;
+    pthread_mutex_lock(&snapshotLock);
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    while (snapshotRunning) {
+        deadline.tv_sec += snapshotIntervalMs / 1000;
+        deadline.tv_nsec += (snapshotIntervalMs % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (snapshotRunning && pthread_cond_timedwait(&snapshotWake, &snapshotLock, &deadline) != ETIMEDOUT);
+        if (!snapshotRunning) break;
+
+        pthread_mutex_unlock(&snapshotLock);
+        FILE *out = fopen(snapshotPath, "a");
+        if (out) {
+            I2Cdev::snapshotStats(out);
+            fclose(out);
+        }
+        pthread_mutex_lock(&snapshotLock);
+    }
+    pthread_mutex_unlock(&snapshotLock);
+    return NULL;
+}
+
+/** Enable statistics and append a snapshotStats() line to a file periodically.
+ * The file is opened for every snapshot, so it can be rotated underneath.
+ * @param path File to append to
+ * @param intervalMs Time between snapshots in milliseconds
+ * @return True if the snapshot thread is running
+ */
+bool I2Cdev::startStatsSnapshots(const char *path, uint32_t intervalMs) {
+    pthread_condattr_t attr;
+
+    stopStatsSnapshots();
+    strncpy(snapshotPath, path, sizeof(snapshotPath) - 1);
+    snapshotPath[sizeof(snapshotPath) - 1] = 0;
+    snapshotIntervalMs = intervalMs > 0 ? intervalMs : 1;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&snapshotWake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    enableStats(true);
+    snapshotRunning = true;
+    if (pthread_create(&snapshotThread, NULL, snapshotRun, NULL) != 0) {
+        snapshotRunning = false;
+        pthread_cond_destroy(&snapshotWake);
+        return false;
+    }
+    return true;
+}
+
+/** Stop the periodic snapshots. Statistics stay enabled.
+ */
+void I2Cdev::stopStatsSnapshots() {
+    pthread_mutex_lock(&snapshotLock);
+    if (!snapshotRunning) {
+        pthread_mutex_unlock(&snapshotLock);
+        return;
+    }
+    snapshotRunning = false;
+    pthread_cond_signal(&snapshotWake);
+    pthread_mutex_unlock(&snapshotLock);
+    pthread_join(snapshotThread, NULL);
+    pthread_cond_destroy(&snapshotWake);
+}
+
 /** Default timeout value for read operations.
  * Set this to 0 to disable timeout detection.
  */
@@ -44,11 +44,54 @@ THE SOFTWARE.
 #ifndef _I2CDEV_H_
 #define _I2CDEV_H_
 
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+
 #ifndef TRUE
 #define TRUE	(1==1)
 #define FALSE	(0==1)
 #endif
 
+#define I2CDEV_DEFAULT_BUS  "/dev/i2c-1"
+
+#define I2CDEV_STATS_BUCKETS    88  // latency histogram: 4 buckets per power of two, 1 us to 8 s
+
+// transaction counters of one (bus, address, register), see I2Cdev::enableStats()
+struct I2CdevStats {
+    uint32_t count;                 // completed or failed transactions
+    uint32_t errors;                // failed transactions, NAKs included
+    uint32_t naks;                  // transactions the device did not acknowledge
+    uint64_t bytes;                 // payload bytes moved, register address excluded
+    uint64_t totalNs;               // sum of transaction latencies
+    uint32_t minNs, maxNs;
+    uint32_t histogram[I2CDEV_STATS_BUCKETS];
+};
+
+class I2Cbus {
+    public:
+        I2Cbus(const char *path=I2CDEV_DEFAULT_BUS);
+        ~I2Cbus();
+
+        const char *getPath();
+
+    private:
+        friend class I2Cdev;
+
+        char path[64];
+        int fd[128];                // cached descriptor per 7-bit slave address, -1 if closed
+        pthread_mutex_t lock;       // guards fd and stats, serializes transfers on this bus
+        I2CdevStats **stats[128];   // per address, 256 register entries, allocated on first use
+        uint32_t contended;         // transfers that found the bus lock taken
+        uint64_t waitNs;            // total time spent waiting for the bus lock
+        I2Cbus *next;               // list of all buses, for the stats dump
+
+        I2Cbus(const I2Cbus &);
+        I2Cbus &operator=(const I2Cbus &);
+        int getDeviceFd(uint8_t devAddr);
+        void dropDeviceFd(uint8_t devAddr);
+};
+
 class I2Cdev {
     public:
         I2Cdev();
@@ -71,7 +114,48 @@ class I2Cdev {
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
 
+        static void closeDevice(uint8_t devAddr);
+
+        // same operations on an explicit bus
+        static int8_t readBit(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBitW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBits(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBitsW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readByte(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readWord(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBytes(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readWords(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+
+        static bool writeBit(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
+        static bool writeBitW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
+        static bool writeBits(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+        static bool writeBitsW(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
+        static bool writeByte(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t data);
+        static bool writeWord(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t data);
+        static bool writeBytes(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        static bool writeWords(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+
+        static void closeDevice(I2Cbus *bus, uint8_t devAddr);
+        static I2Cbus *getDefaultBus();
+
+        // opt-in transaction statistics
+        static void enableStats(bool enabled);
+        static void resetStats();
+        static void dumpStats(FILE *out);
+        static void snapshotStats(FILE *out);
+        static bool startStatsSnapshots(const char *path, uint32_t intervalMs);
+        static void stopStatsSnapshots();
+
         static uint16_t readTimeout;
+
+    private:
+        static bool statsEnabled;
+
+        static bool writeBuffer(I2Cbus *bus, uint8_t devAddr, const uint8_t *buf, uint8_t length);
+        static int8_t readBytesLocked(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        static bool writeBufferLocked(I2Cbus *bus, uint8_t devAddr, const uint8_t *buf, uint8_t length);
+        static void lockBus(I2Cbus *bus);
+        static void recordStats(I2Cbus *bus, uint8_t devAddr, uint8_t regAddr, uint64_t startNs, uint32_t bytes, int error);
 };
 
 #endif /* _I2CDEV_H_ */
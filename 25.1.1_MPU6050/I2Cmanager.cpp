@@ -0,0 +1,354 @@
+// I2Cdev library collection - I2C bus manager
+// Serializes prioritized transactions from many clients on one bus thread
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <string.h>
+#include <time.h>
+#include "I2Cmanager.h"
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/** Create a manager for one bus.
+ * While it runs, every client of the bus should go through the manager: a
+ * direct I2Cdev call is still safe, but bypasses the priorities.
+ * @param bus Bus to own
+ */
+I2Cmanager::I2Cmanager(I2Cbus *bus) {
+    this->bus = bus;
+    running = false;
+    queued = 0;
+    sequence = 0;
+    coalesced = 0;
+    expired = 0;
+    pthread_mutex_init(&lock, NULL);
+    pthread_cond_init(&wake, NULL);
+    pthread_cond_init(&completed, NULL);
+}
+
+I2Cmanager::~I2Cmanager() {
+    stop();
+    pthread_cond_destroy(&completed);
+    pthread_cond_destroy(&wake);
+    pthread_mutex_destroy(&lock);
+}
+
+/** Start the bus thread.
+ * @return True if the thread is running
+ */
+bool I2Cmanager::start() {
+    pthread_mutex_lock(&lock);
+    if (running) {
+        pthread_mutex_unlock(&lock);
+        return true;
+    }
+    running = true;
+    pthread_mutex_unlock(&lock);
+
+    if (pthread_create(&thread, NULL, run, this) != 0) {
+        running = false;
+        return false;
+    }
+    return true;
+}
+
+/** Stop the bus thread.
+ * The transfer in progress finishes; everything still queued completes with
+ * I2CMANAGER_REJECTED.
+ */
+void I2Cmanager::stop() {
+    pthread_mutex_lock(&lock);
+    if (!running) {
+        pthread_mutex_unlock(&lock);
+        return;
+    }
+    running = false;
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+    pthread_join(thread, NULL);
+
+    pthread_mutex_lock(&lock);
+    while (queued > 0) {
+        I2Ctransaction *t = removeAt(0);
+        t->result = I2CMANAGER_REJECTED;
+        t->done = true;
+    }
+    pthread_cond_broadcast(&completed);
+    pthread_mutex_unlock(&lock);
+}
+
+/** Queue a transaction without waiting for it.
+ * The transaction and its data buffer must stay valid until wait() returns.
+ * Transactions run most urgent first: lowest priority value, then earliest
+ * deadline, then submission order. The bus is not preempted, so a
+ * high-priority transaction waits at most for the one transfer in progress;
+ * keep low-priority writes short to bound that wait.
+ * @param transaction Filled-in transaction
+ * Reads are limited to 254 bytes: I2Cdev::readBytes() reports the length as
+ * an int8_t, and a 255-byte read would look like its -1 failure value.
+ * @return False if the queue is full, the manager is stopped or the read is too long
+ */
+bool I2Cmanager::submit(I2Ctransaction *transaction) {
+    pthread_mutex_lock(&lock);
+    if (!running || queued == I2CMANAGER_QUEUE_SIZE || (!transaction->write && transaction->length == 255)) {
+        pthread_mutex_unlock(&lock);
+        transaction->result = I2CMANAGER_REJECTED;
+        transaction->done = true;
+        return false;
+    }
+    transaction->done = false;
+    transaction->result = 0;
+    transaction->sequence = sequence++;
+    push(transaction);
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+    return true;
+}
+
+/** Block until a submitted transaction completes.
+ * @param transaction Transaction passed to submit()
+ * @return Bytes transferred, or an I2CMANAGER_* error
+ */
+int16_t I2Cmanager::wait(I2Ctransaction *transaction) {
+    pthread_mutex_lock(&lock);
+    while (!transaction->done) {
+        pthread_cond_wait(&completed, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+    return transaction->result;
+}
+
+/** Read registers through the manager and wait for the result.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register to read
+ * @param length Number of bytes to read
+ * @param data Buffer for the data
+ * @param priority Lower is more urgent, see I2CMANAGER_PRIORITY_HIGH
+ * @param deadlineUs Give up if the read cannot start within this many microseconds (0 = never)
+ * @param coalesce Allow merging with overlapping or adjacent reads of the same device;
+ *        only for plain registers, never for FIFOs or clear-on-read registers
+ * @return Bytes read, or an I2CMANAGER_* error
+ */
+int16_t I2Cmanager::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+        uint8_t priority, uint32_t deadlineUs, bool coalesce) {
+    I2Ctransaction t;
+
+    t.devAddr = devAddr;
+    t.regAddr = regAddr;
+    t.length = length;
+    t.data = data;
+    t.write = false;
+    t.coalesce = coalesce;
+    t.priority = priority;
+    t.deadline = deadlineUs ? monotonicNs() + (uint64_t)deadlineUs * 1000 : 0;
+    if (!submit(&t)) return I2CMANAGER_REJECTED;
+    return wait(&t);
+}
+
+/** Write registers through the manager and wait for the result.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register to write
+ * @param length Number of bytes to write
+ * @param data Data to write
+ * @param priority Lower is more urgent, see I2CMANAGER_PRIORITY_LOW
+ * @param deadlineUs Give up if the write cannot start within this many microseconds (0 = never)
+ * @return Bytes written, or an I2CMANAGER_* error
+ */
+int16_t I2Cmanager::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+        uint8_t priority, uint32_t deadlineUs) {
+    I2Ctransaction t;
+
+    t.devAddr = devAddr;
+    t.regAddr = regAddr;
+    t.length = length;
+    t.data = data;
+    t.write = true;
+    t.coalesce = false;
+    t.priority = priority;
+    t.deadline = deadlineUs ? monotonicNs() + (uint64_t)deadlineUs * 1000 : 0;
+    if (!submit(&t)) return I2CMANAGER_REJECTED;
+    return wait(&t);
+}
+
+/** Get the number of reads that were served by another read's transfer.
+ * @return Count since construction
+ */
+uint32_t I2Cmanager::getCoalesced() {
+    return coalesced;
+}
+
+/** Get the number of transactions dropped because their deadline passed.
+ * @return Count since construction
+ */
+uint32_t I2Cmanager::getExpired() {
+    return expired;
+}
+
+void *I2Cmanager::run(void *arg) {
+    ((I2Cmanager *)arg)->serve();
+    return NULL;
+}
+
+/** Bus thread: take the most urgent transaction, merge compatible reads into
+ * it, run the transfer with the queue unlocked, and signal completion.
+ */
+void I2Cmanager::serve() {
+    I2Ctransaction *group[I2CMANAGER_QUEUE_SIZE];
+
+    pthread_mutex_lock(&lock);
+    while (true) {
+        while (running && queued == 0) {
+            pthread_cond_wait(&wake, &lock);
+        }
+        if (!running) break;
+
+        I2Ctransaction *head = removeAt(0);
+        if (head->deadline && monotonicNs() > head->deadline) {
+            head->result = I2CMANAGER_EXPIRED;
+            head->done = true;
+            expired++;
+            pthread_cond_broadcast(&completed);
+            continue;
+        }
+
+        uint8_t count = 1;
+        group[0] = head;
+        if (!head->write && head->coalesce) {
+            uint16_t lo = head->regAddr, hi = head->regAddr + head->length;
+            bool grown = true;
+            while (grown) {
+                grown = false;
+                for (uint8_t i = 0; i < queued; i++) {
+                    I2Ctransaction *t = queue[i];
+                    if (t->write || !t->coalesce || t->devAddr != head->devAddr) continue;
+                    uint16_t start = t->regAddr, end = t->regAddr + t->length;
+                    if (start > hi || end < lo) continue;
+                    uint16_t newLo = start < lo ? start : lo;
+                    uint16_t newHi = end > hi ? end : hi;
+                    if (newHi - newLo > I2CMANAGER_COALESCE_MAX) continue;
+                    group[count++] = removeAt(i);
+                    lo = newLo;
+                    hi = newHi;
+                    grown = true;
+                    break;
+                }
+            }
+            coalesced += count - 1;
+        }
+        pthread_mutex_unlock(&lock);
+
+        execute(group, count);
+
+        pthread_mutex_lock(&lock);
+        for (uint8_t i = 0; i < count; i++) {
+            group[i]->done = true;
+        }
+        pthread_cond_broadcast(&completed);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+/** Run one bus transfer for a transaction or a group of merged reads.
+ * @param group Transactions; a group of more than one holds only reads of one device
+ * @param count Number of transactions
+ */
+void I2Cmanager::execute(I2Ctransaction **group, uint8_t count) {
+    I2Ctransaction *t = group[0];
+
+    if (count == 1) {
+        if (t->write) {
+            t->result = I2Cdev::writeBytes(bus, t->devAddr, t->regAddr, t->length, t->data) ? t->length : I2CMANAGER_ERROR;
+        } else {
+            // readBytes() returns the length as int8_t, compare in that type
+            t->result = I2Cdev::readBytes(bus, t->devAddr, t->regAddr, t->length, t->data) == (int8_t)t->length ? t->length : I2CMANAGER_ERROR;
+        }
+        return;
+    }
+
+    uint8_t buffer[I2CMANAGER_COALESCE_MAX];
+    uint16_t lo = t->regAddr, hi = t->regAddr + t->length;
+    for (uint8_t i = 1; i < count; i++) {
+        if (group[i]->regAddr < lo) lo = group[i]->regAddr;
+        if (group[i]->regAddr + group[i]->length > hi) hi = group[i]->regAddr + group[i]->length;
+    }
+    bool ok = I2Cdev::readBytes(bus, t->devAddr, lo, hi - lo, buffer) == hi - lo;
+    for (uint8_t i = 0; i < count; i++) {
+        if (ok) memcpy(group[i]->data, buffer + group[i]->regAddr - lo, group[i]->length);
+        group[i]->result = ok ? group[i]->length : I2CMANAGER_ERROR;
+    }
+}
+
+/** Scheduling order: priority, then deadline (none sorts last), then arrival.
+ */
+bool I2Cmanager::before(const I2Ctransaction *a, const I2Ctransaction *b) {
+    if (a->priority != b->priority) return a->priority < b->priority;
+    uint64_t da = a->deadline ? a->deadline : UINT64_MAX;
+    uint64_t db = b->deadline ? b->deadline : UINT64_MAX;
+    if (da != db) return da < db;
+    return (int32_t)(a->sequence - b->sequence) < 0;
+}
+
+void I2Cmanager::push(I2Ctransaction *transaction) {
+    queue[queued] = transaction;
+    siftUp(queued++);
+}
+
+I2Ctransaction *I2Cmanager::removeAt(uint8_t index) {
+    I2Ctransaction *t = queue[index];
+    queue[index] = queue[--queued];
+    if (index < queued) {
+        siftDown(index);
+        siftUp(index);
+    }
+    return t;
+}
+
+void I2Cmanager::siftUp(uint8_t index) {
+    while (index > 0) {
+        uint8_t parent = (index - 1) / 2;
+        if (!before(queue[index], queue[parent])) break;
+        I2Ctransaction *t = queue[index];
+        queue[index] = queue[parent];
+        queue[parent] = t;
+        index = parent;
+    }
+}
+
+void I2Cmanager::siftDown(uint8_t index) {
+    while (true) {
+        uint8_t child = 2 * index + 1;
+        if (child >= queued) break;
+        if (child + 1 < queued && before(queue[child + 1], queue[child])) child++;
+        if (!before(queue[child], queue[index])) break;
+        I2Ctransaction *t = queue[index];
+        queue[index] = queue[child];
+        queue[child] = t;
+        index = child;
+    }
+}
@@ -0,0 +1,107 @@
+// I2Cdev library collection - I2C bus manager
+// Serializes prioritized transactions from many clients on one bus thread
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CMANAGER_H_
+#define _I2CMANAGER_H_
+
+#include <stdint.h>
+#include <pthread.h>
+#include "I2Cdev.h"
+
+#define I2CMANAGER_QUEUE_SIZE       64      // pending transactions per manager
+#define I2CMANAGER_COALESCE_MAX     32      // longest merged read in bytes
+
+#define I2CMANAGER_PRIORITY_HIGH    0       // e.g. IMU samples
+#define I2CMANAGER_PRIORITY_NORMAL  64      // e.g. barometer, ADC
+#define I2CMANAGER_PRIORITY_LOW     128     // e.g. display updates
+
+#define I2CMANAGER_ERROR            -1      // bus transfer failed
+#define I2CMANAGER_EXPIRED          -2      // deadline passed before the transfer started
+#define I2CMANAGER_REJECTED         -3      // queue full or manager stopped
+
+// one register read or write, owned by the client until it completes
+struct I2Ctransaction {
+    uint8_t devAddr;
+    uint8_t regAddr;
+    uint8_t length;
+    uint8_t *data;                          // destination of a read, source of a write
+    bool write;
+    bool coalesce;                          // read may be merged with adjacent reads of the same device
+    uint8_t priority;                       // lower is more urgent
+    uint64_t deadline;                      // CLOCK_MONOTONIC ns after which the transfer is pointless, 0 = none
+
+    // set by the manager
+    int16_t result;                         // bytes transferred or I2CMANAGER_* error
+    bool done;
+    uint32_t sequence;
+};
+
+class I2Cmanager {
+    public:
+        I2Cmanager(I2Cbus *bus=I2Cdev::getDefaultBus());
+        ~I2Cmanager();
+
+        bool start();
+        void stop();
+
+        bool submit(I2Ctransaction *transaction);
+        int16_t wait(I2Ctransaction *transaction);
+
+        int16_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+                uint8_t priority=I2CMANAGER_PRIORITY_NORMAL, uint32_t deadlineUs=0, bool coalesce=false);
+        int16_t writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+                uint8_t priority=I2CMANAGER_PRIORITY_NORMAL, uint32_t deadlineUs=0);
+
+        uint32_t getCoalesced();
+        uint32_t getExpired();
+
+    private:
+        I2Cbus *bus;
+        pthread_t thread;
+        pthread_mutex_t lock;
+        pthread_cond_t wake;                // queue became non-empty or stop requested
+        pthread_cond_t completed;           // some transaction finished
+        bool running;
+
+        I2Ctransaction *queue[I2CMANAGER_QUEUE_SIZE];   // binary heap, most urgent first
+        uint8_t queued;
+        uint32_t sequence;
+        uint32_t coalesced;
+        uint32_t expired;
+
+        static void *run(void *arg);
+        void serve();
+        void execute(I2Ctransaction **group, uint8_t count);
+
+        static bool before(const I2Ctransaction *a, const I2Ctransaction *b);
+        void push(I2Ctransaction *transaction);
+        I2Ctransaction *removeAt(uint8_t index);
+        void siftUp(uint8_t index);
+        void siftDown(uint8_t index);
+};
+
+#endif /* _I2CMANAGER_H_ */
@@ -40,6 +40,10 @@ THE SOFTWARE.
 #include "I2Cdev.h"
 //#include <avr/pgmspace.h>
 
+#if defined(MPU6050_INCLUDE_DMP_MOTIONAPPS20) || defined(MPU6050_INCLUDE_DMP_MOTIONAPPS41)
+#include "helper_3dmath.h"
+#endif
+
 #define pgm_read_byte(p) (*(uint8_t *)(p))
 
 
@@ -393,19 +397,38 @@ THE SOFTWARE.
 #define MPU6050_WHO_AM_I_BIT        6
 #define MPU6050_WHO_AM_I_LENGTH     6
 
+#define MPU6050_SHADOW_SIZE             0x6D    // registers 0x00-0x6C are mirrored by loadConfig()
+
 #define MPU6050_DMP_MEMORY_BANKS        8
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
-#define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
+#define MPU6050_DMP_MEMORY_CHUNK_SIZE   64  // burst size for MEM_R_W transfers; must divide the bank size
+#define MPU6050_DMP_PACKET_MAX          48  // largest DMP FIFO packet of any MotionApps version
 
 // note: DMP code memory blocks defined at end of header file
 
+// one timestamped accel/gyro reading, as produced by the streaming and interrupt modes
+struct MPU6050Sample {
+    uint64_t timestamp;                         // CLOCK_MONOTONIC nanoseconds
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+};
+
 class MPU6050 {
     public:
         MPU6050();
         MPU6050(uint8_t address);
+        MPU6050(I2Cbus *bus, uint8_t address=MPU6050_DEFAULT_ADDRESS);
 
         void initialize();
         bool testConnection();
+        I2Cbus *getBus();
+        uint8_t getAddress();
+
+        // configuration shadow registers
+        bool loadConfig();
+        bool commitConfig();
+        void cancelConfig();
+        bool getConfigActive();
 
         // AUX_VDDIO register
         uint8_t getAuxVDDIOLevel();
@@ -579,6 +602,7 @@ class MPU6050 {
         // ACCEL_*OUT_* registers
         void getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz);
         void getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz);
+        bool getSensorBytes(uint8_t *data, uint8_t length);
         void getAcceleration(int16_t* x, int16_t* y, int16_t* z);
         int16_t getAccelerationX();
         int16_t getAccelerationY();
@@ -777,12 +801,16 @@ class MPU6050 {
         uint8_t getDMPConfig2();
         void setDMPConfig2(uint8_t config);
 
+        // DMP packet state, declared in every build so the class layout does
+        // not depend on the MPU6050_INCLUDE_DMP_* defines
+        uint8_t dmpPacketBuffer[MPU6050_DMP_PACKET_MAX];
+        uint16_t dmpPacketSize;                 // 0 until dmpInitialize() succeeds
+
         // special methods for MotionApps 2.0 implementation
         #ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
-            uint8_t *dmpPacketBuffer;
-            uint16_t dmpPacketSize;
-
             uint8_t dmpInitialize();
+            uint8_t dmpInitialize(const char *firmwarePath);
+            uint8_t dmpGetCurrentFIFOPacket(uint8_t *data=0);
             bool dmpPacketAvailable();
 
             uint8_t dmpSetFIFORate(uint8_t fifoRate);
@@ -880,9 +908,6 @@ class MPU6050 {
 
         // special methods for MotionApps 4.1 implementation
         #ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS41
-            uint8_t *dmpPacketBuffer;
-            uint16_t dmpPacketSize;
-
             uint8_t dmpInitialize();
             bool dmpPacketAvailable();
 
@@ -981,8 +1006,22 @@ class MPU6050 {
         #endif
 
     private:
+        I2Cbus *bus;
         uint8_t devAddr;
         uint8_t buffer[14];
+
+        // configuration register file mirror, see loadConfig()
+        uint8_t shadow[MPU6050_SHADOW_SIZE];
+        uint8_t shadowDirty[(MPU6050_SHADOW_SIZE + 7) / 8];
+        bool shadowActive;
+
+        static bool isShadowed(uint8_t regAddr);
+        int8_t readRegBit(uint8_t regAddr, uint8_t bitNum, uint8_t *data);
+        int8_t readRegBits(uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data);
+        int8_t readReg(uint8_t regAddr, uint8_t *data);
+        bool writeRegBit(uint8_t regAddr, uint8_t bitNum, uint8_t data);
+        bool writeRegBits(uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+        bool writeReg(uint8_t regAddr, uint8_t data);
 };
 
 #endif /* _MPU6050_H_ */
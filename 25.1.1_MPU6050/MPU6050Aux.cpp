@@ -0,0 +1,155 @@
+// I2Cdev library collection - MPU6050 auxiliary I2C master passthrough
+// Reads external sensors through the MPU6050 slave channels in one burst
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <time.h>
+#include "MPU6050Aux.h"
+
+/** Create a passthrough for an initialized device.
+ * The external sensors must already be configured for continuous measurement
+ * (through bypass mode or their own defaults): the MPU6050 only reads them.
+ * @param device Initialized MPU6050
+ */
+MPU6050Aux::MPU6050Aux(MPU6050 *device) {
+    this->device = device;
+    slaves = 0;
+    dataLength = 0;
+    running = false;
+}
+
+MPU6050Aux::~MPU6050Aux() {
+    end();
+}
+
+/** Add an external sensor read by the next free slave channel.
+ * The MPU6050 stores slave data back to back in slave order, so the returned
+ * offset is where this sensor's bytes start in MPU6050AuxSample::data.
+ * Slaves must be added before begin().
+ * @param address 7-bit I2C address of the external sensor
+ * @param reg First register to read
+ * @param length Number of bytes to read (1-15)
+ * @param swap Swap the bytes of each word (for little-endian sensors)
+ * @return Offset of the data, or -1 if no channel or data space is left
+ */
+int8_t MPU6050Aux::addSlave(uint8_t address, uint8_t reg, uint8_t length, bool swap) {
+    if (running || slaves >= MPU6050_AUX_SLAVES) return -1;
+    if (length == 0 || length > 15 || dataLength + length > MPU6050_AUX_DATA_SIZE) return -1;
+
+    this->address[slaves] = address & 0x7F;
+    this->reg[slaves] = reg;
+    this->length[slaves] = length;
+    this->swap[slaves] = swap;
+    slaves++;
+
+    int8_t offset = dataLength;
+    dataLength += length;
+    return offset;
+}
+
+/** Configure the slave channels and enable the I2C master.
+ * The master reads every slave once per sample period and holds the
+ * data-ready interrupt until all of them are done, so each read() returns
+ * motion and external data from the same period.
+ * @param clockSpeed Auxiliary bus clock, see MPU6050_CLOCK_DIV_400
+ * @return True if the configuration was written
+ */
+bool MPU6050Aux::begin(uint8_t clockSpeed) {
+    if (running) return true;
+
+    // the master can only be reset while it is disabled
+    device->setI2CMasterModeEnabled(false);
+    device->resetI2CMaster();
+
+    bool batched = !device->getConfigActive() && device->loadConfig();
+    device->setI2CBypassEnabled(false);
+    device->setMasterClockSpeed(clockSpeed);
+    device->setWaitForExternalSensorEnabled(true);
+    for (uint8_t i = 0; i < MPU6050_AUX_SLAVES; i++) {
+        if (i >= slaves) {
+            device->setSlaveEnabled(i, false);
+            continue;
+        }
+        device->setSlaveAddress(i, address[i] | 0x80);  // bit 7 selects a read
+        device->setSlaveRegister(i, reg[i]);
+        device->setSlaveDataLength(i, length[i]);
+        device->setSlaveWordByteSwap(i, swap[i]);
+        device->setSlaveWriteMode(i, false);
+        device->setSlaveWordGroupOffset(i, false);
+        device->setSlaveDelayEnabled(i, false);
+        device->setSlaveEnabled(i, true);
+    }
+    device->setI2CMasterModeEnabled(true);
+    if (batched && !device->commitConfig()) return false;
+
+    running = true;
+    return true;
+}
+
+/** Disable the slave channels and the I2C master.
+ */
+void MPU6050Aux::end() {
+    if (!running) return;
+    running = false;
+
+    bool batched = !device->getConfigActive() && device->loadConfig();
+    for (uint8_t i = 0; i < slaves; i++) device->setSlaveEnabled(i, false);
+    device->setI2CMasterModeEnabled(false);
+    if (batched) device->commitConfig();
+}
+
+/** Read motion, temperature and all external sensor data in one transfer.
+ * ACCEL_XOUT_H through the last used EXT_SENS_DATA register are contiguous,
+ * so this is a single burst of 14 + getDataLength() bytes.
+ * @param sample Receives the data, timestamped with CLOCK_MONOTONIC
+ * @return True if the burst was read
+ */
+bool MPU6050Aux::read(MPU6050AuxSample *sample) {
+    uint8_t burst[MPU6050_AUX_BURST_SIZE];
+    struct timespec ts;
+
+    if (!running) return false;
+    if (!device->getSensorBytes(burst, 14 + dataLength)) return false;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    sample->motion.timestamp = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    sample->motion.ax = (((int16_t)burst[0]) << 8) | burst[1];
+    sample->motion.ay = (((int16_t)burst[2]) << 8) | burst[3];
+    sample->motion.az = (((int16_t)burst[4]) << 8) | burst[5];
+    sample->temperature = (((int16_t)burst[6]) << 8) | burst[7];
+    sample->motion.gx = (((int16_t)burst[8]) << 8) | burst[9];
+    sample->motion.gy = (((int16_t)burst[10]) << 8) | burst[11];
+    sample->motion.gz = (((int16_t)burst[12]) << 8) | burst[13];
+    sample->length = dataLength;
+    for (uint8_t i = 0; i < dataLength; i++) sample->data[i] = burst[14 + i];
+    return true;
+}
+
+/** Get the number of external sensor bytes per read().
+ * @return Sum of the lengths of all added slaves
+ */
+uint8_t MPU6050Aux::getDataLength() {
+    return dataLength;
+}
@@ -0,0 +1,69 @@
+// I2Cdev library collection - MPU6050 auxiliary I2C master passthrough
+// Reads external sensors through the MPU6050 slave channels in one burst
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050AUX_H_
+#define _MPU6050AUX_H_
+
+#include <stdint.h>
+#include "MPU6050.h"
+
+#define MPU6050_AUX_SLAVES      4       // slave channels 0-3 feed EXT_SENS_DATA
+#define MPU6050_AUX_DATA_SIZE   24      // EXT_SENS_DATA_00 to EXT_SENS_DATA_23
+#define MPU6050_AUX_BURST_SIZE  (14 + MPU6050_AUX_DATA_SIZE)
+
+// one burst: accel/gyro sample, die temperature and the external sensor bytes
+struct MPU6050AuxSample {
+    MPU6050Sample motion;
+    int16_t temperature;
+    uint8_t length;                             // valid bytes in data
+    uint8_t data[MPU6050_AUX_DATA_SIZE];        // slave data in slave order, see addSlave()
+};
+
+class MPU6050Aux {
+    public:
+        MPU6050Aux(MPU6050 *device);
+        ~MPU6050Aux();
+
+        int8_t addSlave(uint8_t address, uint8_t reg, uint8_t length, bool swap=false);
+        bool begin(uint8_t clockSpeed=MPU6050_CLOCK_DIV_400);
+        void end();
+        bool read(MPU6050AuxSample *sample);
+
+        uint8_t getDataLength();
+
+    private:
+        MPU6050 *device;
+        uint8_t slaves;
+        uint8_t address[MPU6050_AUX_SLAVES];
+        uint8_t reg[MPU6050_AUX_SLAVES];
+        uint8_t length[MPU6050_AUX_SLAVES];
+        bool swap[MPU6050_AUX_SLAVES];
+        uint8_t dataLength;
+        bool running;
+};
+
+#endif /* _MPU6050AUX_H_ */
@@ -0,0 +1,126 @@
+// I2Cdev library collection - MPU6050 unit conversion
+// Batch conversion of raw samples to SI units for the configured full-scale ranges
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <math.h>
+#include <string.h>
+#include "MPU6050Convert.h"
+
+// sensitivity at each full-scale setting, from the MPU-6050 product specification
+static const float accelSensitivity[4] = { 16384.0f, 8192.0f, 4096.0f, 2048.0f };  // LSB/g
+static const float gyroSensitivity[4] = { 131.0f, 65.5f, 32.8f, 16.4f };            // LSB/(deg/s)
+
+/** Create a converter for known ranges and no bias.
+ * @param accelRange MPU6050_ACCEL_FS_2 to MPU6050_ACCEL_FS_16
+ * @param gyroRange MPU6050_GYRO_FS_250 to MPU6050_GYRO_FS_2000
+ */
+MPU6050Convert::MPU6050Convert(uint8_t accelRange, uint8_t gyroRange) {
+    memset(bias, 0, sizeof(bias));
+    setRanges(accelRange, gyroRange);
+}
+
+/** Take the full-scale ranges from the device.
+ * Call this once after configuring the device, and again whenever the ranges
+ * change; convert() itself never touches the bus.
+ * @param device Initialized MPU6050
+ */
+void MPU6050Convert::readRanges(MPU6050 *device) {
+    setRanges(device->getFullScaleAccelRange(), device->getFullScaleGyroRange());
+}
+
+void MPU6050Convert::setRanges(uint8_t accelRange, uint8_t gyroRange) {
+    this->accelRange = accelRange & 0x03;
+    this->gyroRange = gyroRange & 0x03;
+    update();
+}
+
+/** Set the raw accelerometer reading at rest that should convert to zero.
+ * The bias is given in LSB at the current range.
+ */
+void MPU6050Convert::setAccelBias(int16_t x, int16_t y, int16_t z) {
+    bias[0] = x;
+    bias[1] = y;
+    bias[2] = z;
+    update();
+}
+
+/** Set the raw gyroscope reading at rest that should convert to zero.
+ * The bias is given in LSB at the current range.
+ */
+void MPU6050Convert::setGyroBias(int16_t x, int16_t y, int16_t z) {
+    bias[3] = x;
+    bias[4] = y;
+    bias[5] = z;
+    update();
+}
+
+/** Convert a block of raw samples.
+ * Each axis is one multiply-add with precomputed factors, with no divides
+ * and no branches, so the compiler vectorizes the loop.
+ * @param raw Samples as read from the device
+ * @param si Output samples (may not alias raw)
+ * @param count Number of samples
+ */
+void MPU6050Convert::convert(const MPU6050Sample *raw, MPU6050SampleSI *si, uint32_t count) {
+    const float sa = scale[0], oax = offset[0], oay = offset[1], oaz = offset[2];
+    const float sg = scale[3], ogx = offset[3], ogy = offset[4], ogz = offset[5];
+    const MPU6050Sample *__restrict in = raw;
+    MPU6050SampleSI *__restrict out = si;
+
+    for (uint32_t i = 0; i < count; i++) {
+        out[i].timestamp = in[i].timestamp;
+        out[i].ax = in[i].ax * sa + oax;
+        out[i].ay = in[i].ay * sa + oay;
+        out[i].az = in[i].az * sa + oaz;
+        out[i].gx = in[i].gx * sg + ogx;
+        out[i].gy = in[i].gy * sg + ogy;
+        out[i].gz = in[i].gz * sg + ogz;
+    }
+}
+
+/** Get the accelerometer scale factor.
+ * @return m/s^2 per LSB at the current range
+ */
+float MPU6050Convert::getAccelScale() {
+    return scale[0];
+}
+
+/** Get the gyroscope scale factor.
+ * @return rad/s per LSB at the current range
+ */
+float MPU6050Convert::getGyroScale() {
+    return scale[3];
+}
+
+void MPU6050Convert::update() {
+    float accel = MPU6050_STANDARD_GRAVITY / accelSensitivity[accelRange];
+    float gyro = (float)(M_PI / 180.0) / gyroSensitivity[gyroRange];
+
+    for (uint8_t i = 0; i < 6; i++) {
+        scale[i] = i < 3 ? accel : gyro;
+        offset[i] = -bias[i] * scale[i];
+    }
+}
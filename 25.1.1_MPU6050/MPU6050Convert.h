@@ -0,0 +1,65 @@
+// I2Cdev library collection - MPU6050 unit conversion
+// Batch conversion of raw samples to SI units for the configured full-scale ranges
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050CONVERT_H_
+#define _MPU6050CONVERT_H_
+
+#include <stdint.h>
+#include "MPU6050.h"
+
+#define MPU6050_STANDARD_GRAVITY    9.80665f    // m/s^2 per g
+
+// one accel/gyro reading in SI units
+struct MPU6050SampleSI {
+    uint64_t timestamp;                         // CLOCK_MONOTONIC nanoseconds
+    float ax, ay, az;                           // m/s^2
+    float gx, gy, gz;                           // rad/s
+};
+
+class MPU6050Convert {
+    public:
+        MPU6050Convert(uint8_t accelRange=MPU6050_ACCEL_FS_2, uint8_t gyroRange=MPU6050_GYRO_FS_250);
+
+        void readRanges(MPU6050 *device);
+        void setRanges(uint8_t accelRange, uint8_t gyroRange);
+        void setAccelBias(int16_t x, int16_t y, int16_t z);
+        void setGyroBias(int16_t x, int16_t y, int16_t z);
+
+        void convert(const MPU6050Sample *raw, MPU6050SampleSI *si, uint32_t count);
+        float getAccelScale();
+        float getGyroScale();
+
+    private:
+        uint8_t accelRange, gyroRange;
+        int16_t bias[6];                        // raw LSB, ax ay az gx gy gz
+        float scale[6];                         // SI unit per LSB
+        float offset[6];                        // -bias * scale
+
+        void update();
+};
+
+#endif /* _MPU6050CONVERT_H_ */
@@ -0,0 +1,248 @@
+// I2Cdev library collection - MPU6050 sensor fusion
+// Madgwick and Mahony orientation filters over batches of raw MPU6050 samples
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <math.h>
+#include "MPU6050Fusion.h"
+
+/** Create a filter at the identity orientation.
+ * The gyro range defaults to +/-250 deg/s, the range set by MPU6050::initialize().
+ * @param algorithm MPU6050_FUSION_MADGWICK or MPU6050_FUSION_MAHONY
+ * @param sampleRate Rate of the samples passed to update(), in Hz
+ */
+MPU6050Fusion::MPU6050Fusion(uint8_t algorithm, float sampleRate) {
+    this->algorithm = algorithm;
+    setSampleRate(sampleRate);
+    setGyroRange(MPU6050_GYRO_FS_250);
+    setMadgwickGain(MPU6050_FUSION_MADGWICK_BETA);
+    setMahonyGains(MPU6050_FUSION_MAHONY_KP, MPU6050_FUSION_MAHONY_KI);
+    reset();
+}
+
+void MPU6050Fusion::setSampleRate(float sampleRate) {
+    dt = 1.0f / sampleRate;
+}
+
+/** Set the gyro full-scale range the samples were taken with.
+ * @param range MPU6050_GYRO_FS_250 to MPU6050_GYRO_FS_2000
+ */
+void MPU6050Fusion::setGyroRange(uint8_t range) {
+    // 131 LSB per deg/s at +/-250, halved for every doubling of the range
+    gyroScale = (float)(M_PI / 180.0) / (131.0f / (1 << (range & 0x03)));
+}
+
+void MPU6050Fusion::setMadgwickGain(float beta) {
+    this->beta = beta;
+}
+
+void MPU6050Fusion::setMahonyGains(float kp, float ki) {
+    twoKp = 2.0f * kp;
+    twoKi = 2.0f * ki;
+}
+
+/** Return to the identity orientation and clear the integral feedback.
+ */
+void MPU6050Fusion::reset() {
+    q0 = 1.0f;
+    q1 = 0.0f;
+    q2 = 0.0f;
+    q3 = 0.0f;
+    integralX = 0.0f;
+    integralY = 0.0f;
+    integralZ = 0.0f;
+}
+
+/** Run the filter over a batch of raw samples.
+ * Raw values go in unconverted: the accel vector is normalized anyway, so its
+ * scale cancels out, and the gyro scale is folded into one multiplier per batch.
+ * The inner loops have no divides and no calls besides one sqrtf per sample.
+ * Each sample needs the quaternion of the one before, so the loop cannot be
+ * spread over SIMD lanes; normalizing the accel in a separate vectorizable
+ * pass measured no faster, and fixed point only adds work on cores with an FPU.
+ * FusionTest/MPU6050FusionTest checks accuracy and the cost per sample.
+ * @param samples Raw samples in time order
+ * @param count Number of samples
+ */
+void MPU6050Fusion::update(const MPU6050Sample *samples, uint32_t count) {
+    if (algorithm == MPU6050_FUSION_MAHONY) {
+        updateMahony(samples, count);
+    } else {
+        updateMadgwick(samples, count);
+    }
+}
+
+static inline float invSqrt(float x) {
+    return 1.0f / sqrtf(x);
+}
+
+void MPU6050Fusion::updateMadgwick(const MPU6050Sample *samples, uint32_t count) {
+    const float halfGyro = 0.5f * gyroScale;
+    float a0 = q0, a1 = q1, a2 = q2, a3 = q3;
+
+    for (uint32_t i = 0; i < count; i++) {
+        float gx = samples[i].gx * halfGyro;
+        float gy = samples[i].gy * halfGyro;
+        float gz = samples[i].gz * halfGyro;
+        float ax = samples[i].ax;
+        float ay = samples[i].ay;
+        float az = samples[i].az;
+
+        // rate of change of quaternion from gyroscope
+        float qDot0 = -a1 * gx - a2 * gy - a3 * gz;
+        float qDot1 = a0 * gx + a2 * gz - a3 * gy;
+        float qDot2 = a0 * gy - a1 * gz + a3 * gx;
+        float qDot3 = a0 * gz + a1 * gy - a2 * gx;
+
+        // gradient descent corrective step, skipped when the accel reads zero
+        if (ax != 0.0f || ay != 0.0f || az != 0.0f) {
+            float recipNorm = invSqrt(ax * ax + ay * ay + az * az);
+            ax *= recipNorm;
+            ay *= recipNorm;
+            az *= recipNorm;
+
+            float _2q0 = 2.0f * a0;
+            float _2q1 = 2.0f * a1;
+            float _2q2 = 2.0f * a2;
+            float _2q3 = 2.0f * a3;
+            float _4q0 = 4.0f * a0;
+            float _4q1 = 4.0f * a1;
+            float _4q2 = 4.0f * a2;
+            float _8q1 = 8.0f * a1;
+            float _8q2 = 8.0f * a2;
+            float q0q0 = a0 * a0;
+            float q1q1 = a1 * a1;
+            float q2q2 = a2 * a2;
+            float q3q3 = a3 * a3;
+
+            float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+            float s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * a1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+            float s2 = 4.0f * q0q0 * a2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+            float s3 = 4.0f * q1q1 * a3 - _2q1 * ax + 4.0f * q2q2 * a3 - _2q2 * ay;
+            float sNorm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+            if (sNorm > 0.0f) {
+                recipNorm = beta * invSqrt(sNorm);
+                qDot0 -= recipNorm * s0;
+                qDot1 -= recipNorm * s1;
+                qDot2 -= recipNorm * s2;
+                qDot3 -= recipNorm * s3;
+            }
+        }
+
+        // integrate and normalize
+        a0 += qDot0 * dt;
+        a1 += qDot1 * dt;
+        a2 += qDot2 * dt;
+        a3 += qDot3 * dt;
+        float recipNorm = invSqrt(a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3);
+        a0 *= recipNorm;
+        a1 *= recipNorm;
+        a2 *= recipNorm;
+        a3 *= recipNorm;
+    }
+    q0 = a0;
+    q1 = a1;
+    q2 = a2;
+    q3 = a3;
+}
+
+void MPU6050Fusion::updateMahony(const MPU6050Sample *samples, uint32_t count) {
+    const float halfDt = 0.5f * dt;
+    float a0 = q0, a1 = q1, a2 = q2, a3 = q3;
+
+    for (uint32_t i = 0; i < count; i++) {
+        float gx = samples[i].gx * gyroScale;
+        float gy = samples[i].gy * gyroScale;
+        float gz = samples[i].gz * gyroScale;
+        float ax = samples[i].ax;
+        float ay = samples[i].ay;
+        float az = samples[i].az;
+
+        // feedback from the error between measured and estimated gravity
+        if (ax != 0.0f || ay != 0.0f || az != 0.0f) {
+            float recipNorm = invSqrt(ax * ax + ay * ay + az * az);
+            ax *= recipNorm;
+            ay *= recipNorm;
+            az *= recipNorm;
+
+            float halfvx = a1 * a3 - a0 * a2;
+            float halfvy = a0 * a1 + a2 * a3;
+            float halfvz = a0 * a0 - 0.5f + a3 * a3;
+            float halfex = ay * halfvz - az * halfvy;
+            float halfey = az * halfvx - ax * halfvz;
+            float halfez = ax * halfvy - ay * halfvx;
+
+            if (twoKi > 0.0f) {
+                integralX += twoKi * halfex * dt;
+                integralY += twoKi * halfey * dt;
+                integralZ += twoKi * halfez * dt;
+                gx += integralX;
+                gy += integralY;
+                gz += integralZ;
+            }
+            gx += twoKp * halfex;
+            gy += twoKp * halfey;
+            gz += twoKp * halfez;
+        }
+
+        // integrate rate of change of quaternion and normalize
+        gx *= halfDt;
+        gy *= halfDt;
+        gz *= halfDt;
+        float qa = a0, qb = a1, qc = a2;
+        a0 += -qb * gx - qc * gy - a3 * gz;
+        a1 += qa * gx + qc * gz - a3 * gy;
+        a2 += qa * gy - qb * gz + a3 * gx;
+        a3 += qa * gz + qb * gy - qc * gx;
+        float recipNorm = invSqrt(a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3);
+        a0 *= recipNorm;
+        a1 *= recipNorm;
+        a2 *= recipNorm;
+        a3 *= recipNorm;
+    }
+    q0 = a0;
+    q1 = a1;
+    q2 = a2;
+    q3 = a3;
+}
+
+/** Get the current orientation.
+ * @param w, x, y, z Containers for the unit quaternion (sensor to earth frame)
+ */
+void MPU6050Fusion::getQuaternion(float *w, float *x, float *y, float *z) {
+    *w = q0;
+    *x = q1;
+    *y = q2;
+    *z = q3;
+}
+
+/** Get yaw, pitch and roll of the current orientation in radians.
+ * @param data Container for yaw, pitch, roll
+ */
+void MPU6050Fusion::getYawPitchRoll(float *data) {
+    data[0] = atan2f(2.0f * (q1 * q2 + q0 * q3), q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3);
+    data[1] = asinf(fmaxf(-1.0f, fminf(1.0f, -2.0f * (q1 * q3 - q0 * q2))));
+    data[2] = atan2f(2.0f * (q0 * q1 + q2 * q3), q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3);
+}
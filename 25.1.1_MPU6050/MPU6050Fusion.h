@@ -0,0 +1,68 @@
+// I2Cdev library collection - MPU6050 sensor fusion
+// Madgwick and Mahony orientation filters over batches of raw MPU6050 samples
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050FUSION_H_
+#define _MPU6050FUSION_H_
+
+#include <stdint.h>
+#include "MPU6050.h"
+
+#define MPU6050_FUSION_MADGWICK         0
+#define MPU6050_FUSION_MAHONY           1
+
+#define MPU6050_FUSION_MADGWICK_BETA    0.1f    // gradient descent step
+#define MPU6050_FUSION_MAHONY_KP        1.0f    // proportional gain
+#define MPU6050_FUSION_MAHONY_KI        0.0f    // integral gain
+
+class MPU6050Fusion {
+    public:
+        MPU6050Fusion(uint8_t algorithm=MPU6050_FUSION_MADGWICK, float sampleRate=1000.0f);
+
+        void setSampleRate(float sampleRate);
+        void setGyroRange(uint8_t range);
+        void setMadgwickGain(float beta);
+        void setMahonyGains(float kp, float ki);
+        void reset();
+
+        void update(const MPU6050Sample *samples, uint32_t count);
+        void getQuaternion(float *w, float *x, float *y, float *z);
+        void getYawPitchRoll(float *data);
+
+    private:
+        uint8_t algorithm;
+        float dt;                               // sample period in seconds
+        float gyroScale;                        // rad/s per gyro LSB
+        float beta;
+        float twoKp, twoKi;
+        float q0, q1, q2, q3;
+        float integralX, integralY, integralZ;  // Mahony integral feedback
+
+        void updateMadgwick(const MPU6050Sample *samples, uint32_t count);
+        void updateMahony(const MPU6050Sample *samples, uint32_t count);
+};
+
+#endif /* _MPU6050FUSION_H_ */
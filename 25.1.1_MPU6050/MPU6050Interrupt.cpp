@@ -0,0 +1,147 @@
+// I2Cdev library collection - MPU6050 interrupt driven acquisition
+// Reads one sample per data-ready interrupt, timestamped by the kernel
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include "MPU6050Interrupt.h"
+
+/** Create an interrupt reader for an initialized device.
+ * @param device Initialized MPU6050
+ * @param gpio BCM GPIO number wired to the MPU6050 INT pin
+ * @param chip GPIO character device holding that line
+ */
+MPU6050Interrupt::MPU6050Interrupt(MPU6050 *device, uint8_t gpio, const char *chip) {
+    this->device = device;
+    this->gpio = gpio;
+    this->chip = chip;
+    lineFd = -1;
+    missed = 0;
+    lastSeqno = 0;
+}
+
+MPU6050Interrupt::~MPU6050Interrupt() {
+    end();
+}
+
+/** Route data-ready to the INT pin and request its rising edges.
+ * INT is configured active high, push-pull, as a 50 us pulse per sample, so
+ * every sample is exactly one rising edge and nothing has to be acknowledged.
+ * @return True if the INT line is armed
+ */
+bool MPU6050Interrupt::begin() {
+    struct gpio_v2_line_request request;
+
+    end();
+    device->setInterruptMode(false);
+    device->setInterruptDrive(false);
+    device->setInterruptLatch(false);
+    device->setIntEnabled(1 << MPU6050_INTERRUPT_DATA_RDY_BIT);
+
+    int chipFd = open(chip, O_RDWR | O_CLOEXEC);
+    if (chipFd < 0) {
+        fprintf(stderr, "Failed to open %s: %s\n", chip, strerror(errno));
+        return false;
+    }
+    memset(&request, 0, sizeof(request));
+    request.offsets[0] = gpio;
+    request.num_lines = 1;
+    strncpy(request.consumer, "MPU6050", sizeof(request.consumer) - 1);
+    request.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING;
+    if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+        fprintf(stderr, "Failed to request GPIO %d: %s\n", gpio, strerror(errno));
+        close(chipFd);
+        return false;
+    }
+    close(chipFd);
+    lineFd = request.fd;
+    missed = 0;
+    lastSeqno = 0;                              // the kernel numbers edges from 1
+    return true;
+}
+
+/** Disable the device interrupt and release the INT line.
+ */
+void MPU6050Interrupt::end() {
+    if (lineFd < 0) return;
+    device->setIntEnabled(0);
+    close(lineFd);
+    lineFd = -1;
+}
+
+/** Sleep until the next data-ready interrupt and read that sample.
+ * The sample is read with one burst and stamped with the kernel time of the
+ * interrupt edge. When several edges are pending the reader fell behind: the
+ * registers only hold the newest sample, so the older ones are counted as missed.
+ * Edges are counted from their sequence numbers, so edges the kernel dropped
+ * from its own event buffer are counted too.
+ * @param sample Container for the sample
+ * @param timeout Maximum wait in milliseconds (-1 waits forever)
+ * @return 1 if a sample was read, 0 on timeout, -1 on error
+ */
+int8_t MPU6050Interrupt::waitSample(MPU6050Sample *sample, int timeout) {
+    struct gpio_v2_line_event events[16];
+    struct pollfd pfd;
+    uint8_t raw[14];
+
+    if (lineFd < 0) return -1;
+    pfd.fd = lineFd;
+    pfd.events = POLLIN;
+    int ready = poll(&pfd, 1, timeout);
+    if (ready < 0) return -1;
+    if (ready == 0) return 0;
+
+    ssize_t length = read(lineFd, events, sizeof(events));
+    if (length < (ssize_t)sizeof(events[0])) return -1;
+    int n = length / sizeof(events[0]);
+    uint32_t seqno = events[n - 1].line_seqno;
+    missed += seqno - lastSeqno - 1;
+    lastSeqno = seqno;
+
+    // accel, temperature and gyro in one burst; a failed read leaves nothing valid to stamp
+    if (!device->getSensorBytes(raw, 14)) return -1;
+    sample->timestamp = events[n - 1].timestamp_ns;
+    sample->ax = (((int16_t)raw[0]) << 8) | raw[1];
+    sample->ay = (((int16_t)raw[2]) << 8) | raw[3];
+    sample->az = (((int16_t)raw[4]) << 8) | raw[5];
+    sample->gx = (((int16_t)raw[8]) << 8) | raw[9];
+    sample->gy = (((int16_t)raw[10]) << 8) | raw[11];
+    sample->gz = (((int16_t)raw[12]) << 8) | raw[13];
+    return 1;
+}
+
+/** Get the number of samples lost because the reader fell behind.
+ * @return Missed sample count since begin()
+ */
+uint32_t MPU6050Interrupt::getMissedSamples() {
+    return missed;
+}
@@ -0,0 +1,56 @@
+// I2Cdev library collection - MPU6050 interrupt driven acquisition
+// Reads one sample per data-ready interrupt, timestamped by the kernel
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050INTERRUPT_H_
+#define _MPU6050INTERRUPT_H_
+
+#include <stdint.h>
+#include "MPU6050.h"
+
+#define MPU6050_INT_GPIOCHIP    "/dev/gpiochip0"    // GPIO character device of the header pins
+
+class MPU6050Interrupt {
+    public:
+        MPU6050Interrupt(MPU6050 *device, uint8_t gpio, const char *chip=MPU6050_INT_GPIOCHIP);
+        ~MPU6050Interrupt();
+
+        bool begin();
+        void end();
+        int8_t waitSample(MPU6050Sample *sample, int timeout=-1);
+
+        uint32_t getMissedSamples();
+
+    private:
+        MPU6050 *device;
+        uint8_t gpio;
+        const char *chip;
+        int lineFd;
+        uint32_t missed;
+        uint32_t lastSeqno;                     // line_seqno of the last edge consumed
+};
+
+#endif /* _MPU6050INTERRUPT_H_ */
@@ -0,0 +1,208 @@
+// I2Cdev library collection - MPU6050 wake-on-motion
+// Keeps the sensor in low-power cycle mode and wakes the host on motion
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include "MPU6050Motion.h"
+
+/** Create a wake-on-motion monitor for an initialized device.
+ * @param device Initialized MPU6050
+ * @param gpio BCM GPIO number wired to the MPU6050 INT pin
+ * @param chip GPIO character device holding that line
+ */
+MPU6050Motion::MPU6050Motion(MPU6050 *device, uint8_t gpio, const char *chip) {
+    this->device = device;
+    this->gpio = gpio;
+    this->chip = chip;
+    lineFd = -1;
+    wakeFrequency = MPU6050_WAKE_FREQ_5;
+    burstLength = 16;
+    clockSource = MPU6050_CLOCK_PLL_XGYRO;
+}
+
+MPU6050Motion::~MPU6050Motion() {
+    end();
+}
+
+/** Configure motion detection, request the INT line and enter cycle mode.
+ * INT is active high, push-pull and latched until INT_STATUS is read, so a
+ * motion event cannot be lost while the host sleeps.
+ * @param threshold Motion threshold (LSB = 2 mg)
+ * @param duration Samples above the threshold before the interrupt fires
+ * @param wakeFrequency Accelerometer wake-up rate in cycle mode, see MPU6050_WAKE_FREQ_5
+ * @param burstLength Samples read after each motion event (at most MPU6050_MOTION_BURST)
+ * @return True if the monitor is armed
+ */
+bool MPU6050Motion::begin(uint8_t threshold, uint8_t duration, uint8_t wakeFrequency, uint8_t burstLength) {
+    struct gpio_v2_line_request request;
+
+    end();
+    this->wakeFrequency = wakeFrequency;
+    this->burstLength = burstLength > MPU6050_MOTION_BURST ? MPU6050_MOTION_BURST : burstLength;
+    clockSource = device->getClockSource();
+
+    bool batched = !device->getConfigActive() && device->loadConfig();
+    device->setInterruptMode(false);
+    device->setInterruptDrive(false);
+    device->setInterruptLatch(true);
+    device->setInterruptLatchClear(false);
+    device->setMotionDetectionThreshold(threshold);
+    device->setMotionDetectionDuration(duration);
+    device->setAccelerometerPowerOnDelay(1);
+    device->setMotionDetectionCounterDecrement(MPU6050_DETECT_DECREMENT_1);
+    device->setIntEnabled(1 << MPU6050_INTERRUPT_MOT_BIT);
+    if (batched && !device->commitConfig()) return false;
+
+    int chipFd = open(chip, O_RDWR | O_CLOEXEC);
+    if (chipFd < 0) {
+        fprintf(stderr, "Failed to open %s: %s\n", chip, strerror(errno));
+        return false;
+    }
+    memset(&request, 0, sizeof(request));
+    request.offsets[0] = gpio;
+    request.num_lines = 1;
+    strncpy(request.consumer, "MPU6050", sizeof(request.consumer) - 1);
+    request.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING;
+    if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+        fprintf(stderr, "Failed to request GPIO %d: %s\n", gpio, strerror(errno));
+        close(chipFd);
+        return false;
+    }
+    close(chipFd);
+    lineFd = request.fd;
+
+    if (!arm()) {
+        end();
+        return false;
+    }
+    return true;
+}
+
+/** Leave cycle mode, disable the motion interrupt and release the INT line.
+ */
+void MPU6050Motion::end() {
+    if (lineFd < 0) return;
+    wake();
+    device->setIntEnabled(0);
+    device->setInterruptLatch(false);
+    close(lineFd);
+    lineFd = -1;
+}
+
+/** Sleep until the sensor reports motion, then capture a burst of samples.
+ * Between events neither the host nor the bus do any work. After the burst
+ * the sensor goes back to cycle mode with a fresh motion reference.
+ * @param event Container for the event
+ * @param timeout Maximum wait in milliseconds (-1 waits forever)
+ * @return 1 if an event was captured, 0 on timeout, -1 on error
+ */
+int8_t MPU6050Motion::waitEvent(MPU6050MotionEvent *event, int timeout) {
+    struct gpio_v2_line_event events[16];
+    struct pollfd pfd;
+
+    if (lineFd < 0) return -1;
+    pfd.fd = lineFd;
+    pfd.events = POLLIN;
+    int ready = poll(&pfd, 1, timeout);
+    if (ready < 0) return -1;
+    if (ready == 0) return 0;
+
+    ssize_t length = read(lineFd, events, sizeof(events));
+    if (length < (ssize_t)sizeof(events[0])) return -1;
+
+    event->timestamp = events[0].timestamp_ns;
+    event->status = device->getIntStatus();     // also releases the latched INT pin
+    wake();
+    captureBurst(event);
+    return arm() ? 1 : -1;
+}
+
+/** Put the sensor into accelerometer-only cycle mode with motion detection.
+ * The digital high-pass filter is given time to settle on the current
+ * orientation and then held, so the threshold applies to changes from rest.
+ * @return True if the configuration was written
+ */
+bool MPU6050Motion::arm() {
+    device->setDHPFMode(MPU6050_DHPF_5);
+    usleep(MPU6050_MOTION_SETTLE * 1000);
+    device->setDHPFMode(MPU6050_DHPF_HOLD);
+    device->getIntStatus();
+
+    bool batched = !device->getConfigActive() && device->loadConfig();
+    device->setClockSource(MPU6050_CLOCK_INTERNAL);
+    device->setTempSensorEnabled(false);
+    device->setStandbyXGyroEnabled(true);
+    device->setStandbyYGyroEnabled(true);
+    device->setStandbyZGyroEnabled(true);
+    device->setWakeFrequency(wakeFrequency);
+    device->setWakeCycleEnabled(true);
+    device->setSleepEnabled(false);
+    return !batched || device->commitConfig();
+}
+
+/** Return the sensor to full-power measurement with the original clock.
+ */
+void MPU6050Motion::wake() {
+    bool batched = !device->getConfigActive() && device->loadConfig();
+    device->setWakeCycleEnabled(false);
+    device->setStandbyXGyroEnabled(false);
+    device->setStandbyYGyroEnabled(false);
+    device->setStandbyZGyroEnabled(false);
+    device->setTempSensorEnabled(true);
+    device->setClockSource(clockSource);
+    device->setDHPFMode(MPU6050_DHPF_RESET);
+    if (batched) device->commitConfig();
+}
+
+/** Read burstLength samples at the configured sample rate.
+ * The gyroscopes need about 30 ms to start, so gyro values at the start of
+ * the burst can be near zero; the accelerometer is valid from the first sample.
+ * @param event Receives the samples
+ */
+void MPU6050Motion::captureBurst(MPU6050MotionEvent *event) {
+    uint8_t dlpf = device->getDLPFMode();
+    uint32_t baseHz = (dlpf == MPU6050_DLPF_BW_256 || dlpf > MPU6050_DLPF_BW_5) ? 8000 : 1000;
+    uint32_t periodUs = 1000000 * (device->getRate() + 1) / baseHz;
+    struct timespec ts;
+
+    event->count = 0;
+    for (uint8_t i = 0; i < burstLength; i++) {
+        MPU6050Sample *s = &event->samples[i];
+        if (i > 0) usleep(periodUs);
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        s->timestamp = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+        device->getMotion6(&s->ax, &s->ay, &s->az, &s->gx, &s->gy, &s->gz);
+        event->count++;
+    }
+}
@@ -0,0 +1,69 @@
+// I2Cdev library collection - MPU6050 wake-on-motion
+// Keeps the sensor in low-power cycle mode and wakes the host on motion
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050MOTION_H_
+#define _MPU6050MOTION_H_
+
+#include <stdint.h>
+#include "MPU6050.h"
+
+#define MPU6050_MOTION_GPIOCHIP "/dev/gpiochip0"    // GPIO character device of the header pins
+#define MPU6050_MOTION_BURST    32                  // most samples captured per motion event
+#define MPU6050_MOTION_SETTLE   10                  // ms for the high-pass filter to settle before hold
+
+// one motion interrupt and the samples read right after it
+struct MPU6050MotionEvent {
+    uint64_t timestamp;                         // CLOCK_MONOTONIC nanoseconds of the INT edge
+    uint8_t status;                             // INT_STATUS at wake-up
+    uint8_t count;                              // valid entries in samples
+    MPU6050Sample samples[MPU6050_MOTION_BURST];
+};
+
+class MPU6050Motion {
+    public:
+        MPU6050Motion(MPU6050 *device, uint8_t gpio, const char *chip=MPU6050_MOTION_GPIOCHIP);
+        ~MPU6050Motion();
+
+        bool begin(uint8_t threshold=20, uint8_t duration=1, uint8_t wakeFrequency=MPU6050_WAKE_FREQ_5, uint8_t burstLength=16);
+        void end();
+        int8_t waitEvent(MPU6050MotionEvent *event, int timeout=-1);
+
+    private:
+        MPU6050 *device;
+        uint8_t gpio;
+        const char *chip;
+        int lineFd;
+        uint8_t wakeFrequency;
+        uint8_t burstLength;
+        uint8_t clockSource;
+
+        bool arm();
+        void wake();
+        void captureBurst(MPU6050MotionEvent *event);
+};
+
+#endif /* _MPU6050MOTION_H_ */
@@ -15,6 +15,8 @@ MPU6050 accelgyro;                                      // Create MPU6050 class
 
 int16_t ax, ay, az;                                     // Variables to store acceleration data
 int16_t gx, gy, gz;                                     // Variables to store gyroscope data
+float accelLSB = 16384.0;                               // LSB per g of the configured accel range
+float gyroLSB = 131.0;                                  // LSB per d/s of the configured gyro range
 
 // Setup function to initialize the MPU6050 sensor
 void setup() {
@@ -29,6 +31,8 @@ void setup() {
     } else {
         printf("MPU6050 connection failed\n");          // Print failure message
     }
+    accelLSB = 16384.0 / (1 << accelgyro.getFullScaleAccelRange()); // 16384 LSB/g at +-2 g, halved per range step
+    gyroLSB = 131.0 / (1 << accelgyro.getFullScaleGyroRange());     // 131 LSB/(d/s) at +-250 d/s, halved per range step
 }
 
 // Loop function to continuously read and display sensor data
@@ -44,10 +48,10 @@ void loop() {
 
     // Convert and display accel values in g and gyro values in d/s with better alignment
     printf("Accel (g):       X: %7.2f   Y: %7.2f   Z: %7.2f\n",
-           (float)ax / 16384.0, (float)ay / 16384.0, (float)az / 16384.0); // Print accel values
+           (float)ax / accelLSB, (float)ay / accelLSB, (float)az / accelLSB); // Print accel values
 
     printf("Gyro  (d/s):     X: %7.2f   Y: %7.2f   Z: %7.2f\n",
-           (float)gx / 131.0, (float)gy / 131.0, (float)gz / 131.0); // Print gyro values
+           (float)gx / gyroLSB, (float)gy / gyroLSB, (float)gz / gyroLSB); // Print gyro values
     
     usleep(500000);                                     // Delay for 500 milliseconds
 }
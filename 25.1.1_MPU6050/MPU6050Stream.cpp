@@ -0,0 +1,246 @@
+// I2Cdev library collection - MPU6050 FIFO streaming
+// Continuous capture of accel/gyro samples through the MPU6050 FIFO
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "MPU6050Stream.h"
+
+/** Largest FIFO read per transfer: the biggest whole number of samples whose
+ * length still fits the int8_t byte count returned by I2Cdev::readBytes().
+ */
+#define MPU6050_STREAM_BURST ((127 / MPU6050_STREAM_SAMPLE_SIZE) * MPU6050_STREAM_SAMPLE_SIZE)
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/** Create a stream for an initialized device.
+ * While the stream runs, its thread is the only one that may talk to the
+ * device: MPU6050 methods share one internal buffer.
+ * @param device Initialized MPU6050
+ */
+MPU6050Stream::MPU6050Stream(MPU6050 *device) {
+    this->device = device;
+    running = false;
+    periodNs = 1000000;
+    head = 0;
+    tail = 0;
+    overflows = 0;
+    dropped = 0;
+}
+
+MPU6050Stream::~MPU6050Stream() {
+    stop();
+}
+
+/** Configure the FIFO and start draining it in the background.
+ * The gyro output rate is 1 kHz with the DLPF enabled, so the sample rate is
+ * 1000 / (1 + SMPLRT_DIV). At 1 kHz the FIFO fills with 12 kB/s, which needs
+ * the bus at 400 kHz (dtparam=i2c_arm_baudrate=400000).
+ * @param rate Sample rate in Hz (4 to 1000)
+ * @param dlpfMode DLPF bandwidth, must not be MPU6050_DLPF_BW_256 (which runs the gyro at 8 kHz)
+ * @return True if the drain thread is running
+ * @see MPU6050_DLPF_BW_188
+ */
+bool MPU6050Stream::start(uint16_t rate, uint8_t dlpfMode) {
+    if (running) return true;
+    if (rate < 4) rate = 4;
+    if (rate > 1000) rate = 1000;
+    if (dlpfMode == MPU6050_DLPF_BW_256) dlpfMode = MPU6050_DLPF_BW_188;
+
+    uint8_t divider = 1000 / rate - 1;
+    periodNs = 1000000UL * (divider + 1);
+
+    // the setters below land in the shadow registers and go out in two bursts
+    bool batched = !device->getConfigActive() && device->loadConfig();
+    device->setFIFOEnabled(false);
+    device->setDLPFMode(dlpfMode);
+    device->setRate(divider);
+    device->setTempFIFOEnabled(false);
+    device->setAccelFIFOEnabled(true);
+    device->setXGyroFIFOEnabled(true);
+    device->setYGyroFIFOEnabled(true);
+    device->setZGyroFIFOEnabled(true);
+    if (batched) device->commitConfig();
+    device->resetFIFO();
+    device->setFIFOEnabled(true);
+
+    head = 0;
+    tail = 0;
+    overflows = 0;
+    dropped = 0;
+    running = true;
+    if (pthread_create(&thread, NULL, run, this) != 0) {
+        running = false;
+        device->setFIFOEnabled(false);
+        return false;
+    }
+    return true;
+}
+
+/** Stop the drain thread and disable the FIFO.
+ * Samples already in the ring buffer can still be read.
+ */
+void MPU6050Stream::stop() {
+    if (!running) return;
+    running = false;
+    pthread_join(thread, NULL);
+    device->setFIFOEnabled(false);
+}
+
+/** Copy the oldest buffered samples out of the ring buffer.
+ * Lock-free: the drain thread only moves head, the consumer only moves tail,
+ * so a single consumer never blocks the capture.
+ * @param samples Destination array
+ * @param maxSamples Capacity of samples
+ * @return Number of samples copied
+ */
+uint32_t MPU6050Stream::read(MPU6050Sample *samples, uint32_t maxSamples) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t n = head.load(std::memory_order_acquire) - t;
+    if (n > maxSamples) n = maxSamples;
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = ring[(t + i) & (MPU6050_STREAM_RING_SIZE - 1)];
+    }
+    tail.store(t + n, std::memory_order_release);
+    return n;
+}
+
+/** Get the number of samples waiting in the ring buffer.
+ * @return Buffered sample count
+ */
+uint32_t MPU6050Stream::available() {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+}
+
+/** Get the number of device FIFO overflows and failed reads recovered so far.
+ * Every recovery loses the samples that were in the FIFO.
+ * @return Recovery count
+ */
+uint32_t MPU6050Stream::getFIFOOverflows() {
+    return overflows;
+}
+
+/** Get the number of samples dropped because the ring buffer was full.
+ * @return Dropped sample count
+ */
+uint32_t MPU6050Stream::getDroppedSamples() {
+    return dropped;
+}
+
+/** Get the configured sample period.
+ * @return Sample period in microseconds
+ */
+uint32_t MPU6050Stream::getPeriodUs() {
+    return periodNs / 1000;
+}
+
+void *MPU6050Stream::run(void *arg) {
+    MPU6050Stream *stream = (MPU6050Stream *)arg;
+    while (stream->running) {
+        stream->drain();
+        usleep(MPU6050_STREAM_DRAIN_INTERVAL * 1000);
+    }
+    return NULL;
+}
+
+/** Reset the FIFO after an overflow, a misaligned count or a failed read.
+ * After an overflow or a partial read the FIFO no longer starts on a sample
+ * boundary, so the only safe recovery is to throw its contents away.
+ */
+void MPU6050Stream::recover() {
+    overflows++;
+    device->resetFIFO();
+}
+
+/** Append one FIFO packet to the ring buffer, dropping it if the ring is full.
+ * @param packet 12 bytes of big-endian accel XYZ and gyro XYZ
+ * @param timestamp Sample time in nanoseconds
+ */
+void MPU6050Stream::push(const uint8_t *packet, uint64_t timestamp) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= MPU6050_STREAM_RING_SIZE) {
+        dropped++;
+        return;
+    }
+    MPU6050Sample *s = &ring[h & (MPU6050_STREAM_RING_SIZE - 1)];
+    s->timestamp = timestamp;
+    s->ax = (((int16_t)packet[0]) << 8) | packet[1];
+    s->ay = (((int16_t)packet[2]) << 8) | packet[3];
+    s->az = (((int16_t)packet[4]) << 8) | packet[5];
+    s->gx = (((int16_t)packet[6]) << 8) | packet[7];
+    s->gy = (((int16_t)packet[8]) << 8) | packet[9];
+    s->gz = (((int16_t)packet[10]) << 8) | packet[11];
+    head.store(h + 1, std::memory_order_release);
+}
+
+/** Move every complete sample from the device FIFO to the ring buffer.
+ * The newest sample is stamped with the time the FIFO count was read and each
+ * older one one sample period earlier. The whole batch is read before any of
+ * it is published, so a failed transfer drops the batch instead of pushing
+ * stale bytes as samples.
+ */
+void MPU6050Stream::drain() {
+    uint8_t fifo[MPU6050_FIFO_SIZE];
+    uint8_t countBytes[2];
+    I2Cbus *bus = device->getBus();
+    uint8_t devAddr = device->getAddress();
+
+    if (I2Cdev::readBytes(bus, devAddr, MPU6050_RA_FIFO_COUNTH, 2, countBytes) != 2) {
+        recover();
+        return;
+    }
+    uint64_t now = monotonicNs();
+    uint16_t count = (((uint16_t)countBytes[0]) << 8) | countBytes[1];
+
+    if (count >= MPU6050_FIFO_SIZE || count % MPU6050_STREAM_SAMPLE_SIZE != 0) {
+        recover();
+        return;
+    }
+
+    if (count == 0) return;
+
+    for (uint16_t offset = 0; offset < count; ) {
+        uint8_t length = count - offset > MPU6050_STREAM_BURST ? MPU6050_STREAM_BURST : count - offset;
+        if (I2Cdev::readBytes(bus, devAddr, MPU6050_RA_FIFO_R_W, length, fifo + offset) != length) {
+            recover();
+            return;
+        }
+        offset += length;
+    }
+
+    uint16_t samples = count / MPU6050_STREAM_SAMPLE_SIZE;
+    uint64_t timestamp = now - (uint64_t)(samples - 1) * periodNs;
+    for (uint16_t i = 0; i < count; i += MPU6050_STREAM_SAMPLE_SIZE) {
+        push(fifo + i, timestamp);
+        timestamp += periodNs;
+    }
+}
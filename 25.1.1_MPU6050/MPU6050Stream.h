@@ -0,0 +1,74 @@
+// I2Cdev library collection - MPU6050 FIFO streaming
+// Continuous capture of accel/gyro samples through the MPU6050 FIFO
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050STREAM_H_
+#define _MPU6050STREAM_H_
+
+#include <stdint.h>
+#include <pthread.h>
+#include <atomic>
+#include "MPU6050.h"
+
+#define MPU6050_FIFO_SIZE               1024    // FIFO capacity of the MPU6050 in bytes
+#define MPU6050_STREAM_SAMPLE_SIZE      12      // accel XYZ + gyro XYZ, 16 bits each
+#define MPU6050_STREAM_RING_SIZE        4096    // ring buffer capacity in samples, power of two
+#define MPU6050_STREAM_DRAIN_INTERVAL   10      // ms between FIFO drains (FIFO holds 85 ms at 1 kHz)
+
+class MPU6050Stream {
+    public:
+        MPU6050Stream(MPU6050 *device);
+        ~MPU6050Stream();
+
+        bool start(uint16_t rate=1000, uint8_t dlpfMode=MPU6050_DLPF_BW_188);
+        void stop();
+
+        uint32_t read(MPU6050Sample *samples, uint32_t maxSamples);
+        uint32_t available();
+
+        uint32_t getFIFOOverflows();
+        uint32_t getDroppedSamples();
+        uint32_t getPeriodUs();
+
+    private:
+        MPU6050 *device;
+        pthread_t thread;
+        std::atomic<bool> running;
+        uint32_t periodNs;
+
+        MPU6050Sample ring[MPU6050_STREAM_RING_SIZE];
+        std::atomic<uint32_t> head;             // next slot written by the drain thread
+        std::atomic<uint32_t> tail;             // next slot read by the consumer
+        std::atomic<uint32_t> overflows;
+        std::atomic<uint32_t> dropped;
+
+        static void *run(void *arg);
+        void drain();
+        void push(const uint8_t *packet, uint64_t timestamp);
+        void recover();
+};
+
+#endif /* _MPU6050STREAM_H_ */
@@ -0,0 +1,235 @@
+// I2Cdev library collection - MPU6050 vibration analysis
+// Overlapping real-FFT spectra and band energies over accelerometer streams
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <math.h>
+#include <string.h>
+#include "MPU6050Vibration.h"
+
+#define HALF    (MPU6050_VIBRATION_WINDOW / 2)
+
+/** One radix-2 stage over a group of 2h points.
+ * The a and b halves never overlap, so with split real/imaginary arrays and
+ * contiguous per-stage twiddles the loop vectorizes (NEON on the Pi, SSE/AVX
+ * on x86) without intrinsics.
+ */
+static inline void butterflies(float *__restrict ar, float *__restrict ai,
+        float *__restrict br, float *__restrict bi,
+        const float *__restrict wr, const float *__restrict wi, uint16_t h) {
+    for (uint16_t k = 0; k < h; k++) {
+        float tr = br[k] * wr[k] - bi[k] * wi[k];
+        float ti = br[k] * wi[k] + bi[k] * wr[k];
+        br[k] = ar[k] - tr;
+        bi[k] = ai[k] - ti;
+        ar[k] += tr;
+        ai[k] += ti;
+    }
+}
+
+/** Create an analyzer with eight equal-width bands from 0 Hz to Nyquist.
+ * @param sampleRate Rate of the samples passed to update(), in Hz
+ */
+MPU6050Vibration::MPU6050Vibration(float sampleRate) {
+    uint16_t bits = 0;
+    while ((1 << bits) < HALF) bits++;
+
+    windowGain = 0.0f;
+    windowPower = 0.0f;
+    for (uint16_t n = 0; n < MPU6050_VIBRATION_WINDOW; n++) {
+        window[n] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * n / MPU6050_VIBRATION_WINDOW);
+        windowGain += window[n];
+        windowPower += window[n] * window[n];
+    }
+    for (uint16_t h = 1; h < HALF; h <<= 1) {
+        for (uint16_t k = 0; k < h; k++) {
+            twiddleRe[h - 1 + k] = cosf((float)M_PI * k / h);
+            twiddleIm[h - 1 + k] = -sinf((float)M_PI * k / h);
+        }
+    }
+    for (uint16_t k = 0; k < MPU6050_VIBRATION_BINS; k++) {
+        splitRe[k] = cosf(2.0f * (float)M_PI * k / MPU6050_VIBRATION_WINDOW);
+        splitIm[k] = -sinf(2.0f * (float)M_PI * k / MPU6050_VIBRATION_WINDOW);
+    }
+    for (uint16_t k = 0; k < HALF; k++) {
+        uint16_t r = 0;
+        for (uint16_t b = 0; b < bits; b++) r |= ((k >> b) & 1) << (bits - 1 - b);
+        bitReverse[k] = r;
+    }
+
+    this->sampleRate = sampleRate;
+    for (uint8_t b = 0; b <= MPU6050_VIBRATION_BANDS; b++) {
+        bandEdges[b] = sampleRate / 2.0f * b / MPU6050_VIBRATION_BANDS;
+    }
+    updateBands();
+    reset();
+}
+
+/** Set the stream sample rate, keeping the band edges in Hz.
+ * @param sampleRate Rate of the samples passed to update(), in Hz
+ */
+void MPU6050Vibration::setSampleRate(float sampleRate) {
+    this->sampleRate = sampleRate;
+    updateBands();
+}
+
+/** Set the band boundaries.
+ * Band b covers [edges[b], edges[b+1]); the last edge is inclusive.
+ * @param edges MPU6050_VIBRATION_BANDS + 1 ascending frequencies in Hz
+ */
+void MPU6050Vibration::setBandEdges(const float *edges) {
+    memcpy(bandEdges, edges, sizeof(bandEdges));
+    updateBands();
+}
+
+/** Drop buffered samples; the next window starts from scratch.
+ */
+void MPU6050Vibration::reset() {
+    filled = 0;
+    memset(power, 0, sizeof(power));
+}
+
+/** Feed stream samples and collect one feature record per completed window.
+ * Windows are MPU6050_VIBRATION_WINDOW samples long and start every
+ * MPU6050_VIBRATION_HOP samples. When features is full, further windows are
+ * skipped rather than analyzed.
+ * @param samples Consecutive samples, e.g. from MPU6050Stream::read()
+ * @param count Number of samples
+ * @param features Output records
+ * @param maxFeatures Capacity of features (count / MPU6050_VIBRATION_HOP + 1 never skips)
+ * @return Number of records written
+ */
+uint32_t MPU6050Vibration::update(const MPU6050Sample *samples, uint32_t count, MPU6050VibrationFeatures *features, uint32_t maxFeatures) {
+    uint32_t produced = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        history[0][filled] = samples[i].ax;
+        history[1][filled] = samples[i].ay;
+        history[2][filled] = samples[i].az;
+        if (++filled < MPU6050_VIBRATION_WINDOW) continue;
+
+        if (produced < maxFeatures) {
+            features[produced].timestamp = samples[i].timestamp;
+            analyze(&features[produced]);
+            produced++;
+        }
+        for (uint8_t axis = 0; axis < MPU6050_VIBRATION_AXES; axis++) {
+            memmove(history[axis], history[axis] + MPU6050_VIBRATION_HOP,
+                    (MPU6050_VIBRATION_WINDOW - MPU6050_VIBRATION_HOP) * sizeof(float));
+        }
+        filled = MPU6050_VIBRATION_WINDOW - MPU6050_VIBRATION_HOP;
+    }
+    return produced;
+}
+
+/** Get the power spectrum of the last analyzed window.
+ * @param axis 0 = X, 1 = Y, 2 = Z
+ * @return MPU6050_VIBRATION_BINS mean-square values, bin k at k * sampleRate / MPU6050_VIBRATION_WINDOW Hz
+ */
+const float *MPU6050Vibration::getSpectrum(uint8_t axis) {
+    return power[axis < MPU6050_VIBRATION_AXES ? axis : 0];
+}
+
+void MPU6050Vibration::updateBands() {
+    for (uint8_t b = 0; b <= MPU6050_VIBRATION_BANDS; b++) {
+        float bin = ceilf(bandEdges[b] * MPU6050_VIBRATION_WINDOW / sampleRate);
+        if (bin < 0.0f) bin = 0.0f;
+        if (bin > MPU6050_VIBRATION_BINS) bin = MPU6050_VIBRATION_BINS;
+        bandStart[b] = (uint16_t)bin;
+    }
+    if (bandEdges[MPU6050_VIBRATION_BANDS] >= sampleRate / 2.0f) bandStart[MPU6050_VIBRATION_BANDS] = MPU6050_VIBRATION_BINS;
+}
+
+/** Window, transform and reduce the current history of every axis.
+ * @param features Receives everything except the timestamp
+ */
+void MPU6050Vibration::analyze(MPU6050VibrationFeatures *features) {
+    float input[MPU6050_VIBRATION_WINDOW];
+
+    for (uint8_t axis = 0; axis < MPU6050_VIBRATION_AXES; axis++) {
+        const float *x = history[axis];
+        float *p = power[axis];
+        float mean = 0.0f, square = 0.0f;
+
+        for (uint16_t n = 0; n < MPU6050_VIBRATION_WINDOW; n++) mean += x[n];
+        mean /= MPU6050_VIBRATION_WINDOW;
+        for (uint16_t n = 0; n < MPU6050_VIBRATION_WINDOW; n++) {
+            float d = x[n] - mean;
+            square += d * d;
+            input[n] = d * window[n];
+        }
+        features->rms[axis] = sqrtf(square / MPU6050_VIBRATION_WINDOW);
+
+        realFFT(input, p);
+
+        // |X|^2 to one-sided mean square, so the bins sum to the windowed variance
+        float scale = 2.0f / (MPU6050_VIBRATION_WINDOW * windowPower);
+        uint16_t peak = 1;
+        for (uint16_t k = 1; k < MPU6050_VIBRATION_BINS; k++) {
+            if (p[k] > p[peak]) peak = k;
+        }
+        features->peakFrequency[axis] = peak * sampleRate / MPU6050_VIBRATION_WINDOW;
+        features->peakAmplitude[axis] = 2.0f * sqrtf(p[peak]) / windowGain;
+
+        p[0] *= scale / 2.0f;
+        for (uint16_t k = 1; k < MPU6050_VIBRATION_BINS - 1; k++) p[k] *= scale;
+        p[MPU6050_VIBRATION_BINS - 1] *= scale / 2.0f;
+
+        for (uint8_t b = 0; b < MPU6050_VIBRATION_BANDS; b++) {
+            float energy = 0.0f;
+            for (uint16_t k = bandStart[b]; k < bandStart[b + 1]; k++) energy += p[k];
+            features->bandEnergy[axis][b] = energy;
+        }
+    }
+}
+
+/** Power spectrum |X[k]|^2 of MPU6050_VIBRATION_WINDOW real samples.
+ * The even and odd samples are packed into one complex FFT of half the size,
+ * whose output is then split into the spectrum of the real signal.
+ * @param input Windowed samples
+ * @param power Receives MPU6050_VIBRATION_BINS values
+ */
+void MPU6050Vibration::realFFT(const float *input, float *power) {
+    for (uint16_t k = 0; k < HALF; k++) {
+        fftRe[bitReverse[k]] = input[2 * k];
+        fftIm[bitReverse[k]] = input[2 * k + 1];
+    }
+    for (uint16_t h = 1; h < HALF; h <<= 1) {
+        for (uint16_t j = 0; j < HALF; j += 2 * h) {
+            butterflies(fftRe + j, fftIm + j, fftRe + j + h, fftIm + j + h, twiddleRe + h - 1, twiddleIm + h - 1, h);
+        }
+    }
+    for (uint16_t k = 0; k < MPU6050_VIBRATION_BINS; k++) {
+        uint16_t a = k & (HALF - 1);
+        uint16_t b = (HALF - k) & (HALF - 1);
+        float evenRe = 0.5f * (fftRe[a] + fftRe[b]);
+        float evenIm = 0.5f * (fftIm[a] - fftIm[b]);
+        float oddRe = 0.5f * (fftIm[a] + fftIm[b]);
+        float oddIm = 0.5f * (fftRe[b] - fftRe[a]);
+        float re = evenRe + splitRe[k] * oddRe - splitIm[k] * oddIm;
+        float im = evenIm + splitRe[k] * oddIm + splitIm[k] * oddRe;
+        power[k] = re * re + im * im;
+    }
+}
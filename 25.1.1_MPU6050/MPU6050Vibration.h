@@ -0,0 +1,84 @@
+// I2Cdev library collection - MPU6050 vibration analysis
+// Overlapping real-FFT spectra and band energies over accelerometer streams
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050VIBRATION_H_
+#define _MPU6050VIBRATION_H_
+
+#include <stdint.h>
+#include "MPU6050.h"
+
+#define MPU6050_VIBRATION_WINDOW    256     // samples per FFT window (power of two)
+#define MPU6050_VIBRATION_HOP       128     // samples between windows (50% overlap)
+#define MPU6050_VIBRATION_BINS      (MPU6050_VIBRATION_WINDOW / 2 + 1)
+#define MPU6050_VIBRATION_BANDS     8
+#define MPU6050_VIBRATION_AXES      3
+
+// compact result of one window, in raw accelerometer LSB
+struct MPU6050VibrationFeatures {
+    uint64_t timestamp;                                     // timestamp of the newest sample in the window
+    float rms[MPU6050_VIBRATION_AXES];                      // AC RMS per axis
+    float peakFrequency[MPU6050_VIBRATION_AXES];            // Hz of the strongest non-DC bin
+    float peakAmplitude[MPU6050_VIBRATION_AXES];            // sine amplitude at that bin
+    float bandEnergy[MPU6050_VIBRATION_AXES][MPU6050_VIBRATION_BANDS];  // mean square per band; sums to rms^2
+};
+
+class MPU6050Vibration {
+    public:
+        MPU6050Vibration(float sampleRate=1000.0f);
+
+        void setSampleRate(float sampleRate);
+        void setBandEdges(const float *edges);
+        void reset();
+
+        uint32_t update(const MPU6050Sample *samples, uint32_t count, MPU6050VibrationFeatures *features, uint32_t maxFeatures);
+        const float *getSpectrum(uint8_t axis);
+
+    private:
+        float sampleRate;
+        float bandEdges[MPU6050_VIBRATION_BANDS + 1];
+        uint16_t bandStart[MPU6050_VIBRATION_BANDS + 1];   // first bin of each band, in bins
+        uint32_t filled;                                    // samples in history
+
+        float history[MPU6050_VIBRATION_AXES][MPU6050_VIBRATION_WINDOW];
+        float window[MPU6050_VIBRATION_WINDOW];             // Hann coefficients
+        float windowGain;                                   // sum of the coefficients
+        float windowPower;                                  // sum of the squared coefficients
+        float twiddleRe[MPU6050_VIBRATION_WINDOW / 2];      // per-stage twiddles, stage h at offset h-1
+        float twiddleIm[MPU6050_VIBRATION_WINDOW / 2];
+        float splitRe[MPU6050_VIBRATION_BINS];              // real-FFT post-processing twiddles
+        float splitIm[MPU6050_VIBRATION_BINS];
+        uint16_t bitReverse[MPU6050_VIBRATION_WINDOW / 2];
+        float fftRe[MPU6050_VIBRATION_WINDOW / 2];
+        float fftIm[MPU6050_VIBRATION_WINDOW / 2];
+        float power[MPU6050_VIBRATION_AXES][MPU6050_VIBRATION_BINS];
+
+        void updateBands();
+        void analyze(MPU6050VibrationFeatures *features);
+        void realFFT(const float *input, float *power);
+};
+
+#endif /* _MPU6050VIBRATION_H_ */
@@ -0,0 +1,352 @@
+// I2Cdev library collection - MPU6050 I2C device class, 6-axis MotionApps 2.0 implementation
+// Based on InvenSense MPU-6050 register map document rev. 2.0, 5/19/2011 (RM-MPU-6000A-00)
+// Linux port of the MotionApps 2.0 DMP support from https://github.com/jrowberg/i2cdevlib
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include "MPU6050_6Axis_MotionApps20.h"
+
+#ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
+
+static_assert(MPU6050_DMP_PACKET_SIZE <= MPU6050_DMP_PACKET_MAX, "dmpPacketBuffer too small");
+
+/** Largest FIFO read per transfer, so that the length fits the int8_t byte
+ * count returned by I2Cdev::readBytes().
+ */
+#define MPU6050_DMP_FIFO_BURST          127
+
+/** Read the FIFO count, checking the transfer.
+ * getFIFOCount() returns a stale count from the shared buffer when the read fails.
+ * @return True if count holds the current count
+ */
+static bool readFIFOCount(I2Cbus *bus, uint8_t devAddr, uint16_t *count) {
+    uint8_t data[2];
+    if (I2Cdev::readBytes(bus, devAddr, MPU6050_RA_FIFO_COUNTH, 2, data) != 2) return false;
+    *count = (((uint16_t)data[0]) << 8) | data[1];
+    return true;
+}
+
+/** Read bytes from the FIFO in bursts, checking every transfer.
+ * @param data Destination, or NULL to discard the bytes
+ * @return True if all length bytes were read
+ */
+static bool readFIFO(I2Cbus *bus, uint8_t devAddr, uint8_t *data, uint16_t length) {
+    uint8_t discard[MPU6050_DMP_FIFO_BURST];
+    while (length > 0) {
+        uint8_t chunk = length > MPU6050_DMP_FIFO_BURST ? MPU6050_DMP_FIFO_BURST : length;
+        uint8_t *dest = data != NULL ? data : discard;
+        if (I2Cdev::readBytes(bus, devAddr, MPU6050_RA_FIFO_R_W, chunk, dest) != chunk) return false;
+        if (data != NULL) data += chunk;
+        length -= chunk;
+    }
+    return true;
+}
+
+/** Load the MotionApps 2.0 firmware from MPU6050_DMP_FIRMWARE and start the DMP.
+ * @return 0 on success, 1 if the firmware could not be loaded, 2 if the FIFO rate update failed
+ * @see dmpInitialize(const char *)
+ */
+uint8_t MPU6050::dmpInitialize() {
+    return dmpInitialize(MPU6050_DMP_FIRMWARE);
+}
+
+/** Reset the device, upload the DMP firmware and configure the DMP FIFO output.
+ * The image is written through writeMemoryBlock() in MPU6050_DMP_MEMORY_CHUNK_SIZE
+ * bursts and verified. Afterwards the DMP writes one MPU6050_DMP_PACKET_SIZE packet
+ * (quaternion, gyro, accel) to the FIFO at 100 Hz; enable it with setDMPEnabled(true).
+ * @param firmwarePath Raw MotionApps 2.0 image, MPU6050_DMP_CODE_SIZE bytes
+ * @return 0 on success, 1 if the firmware could not be loaded, 2 if the FIFO rate update failed
+ */
+uint8_t MPU6050::dmpInitialize(const char *firmwarePath) {
+    uint8_t firmware[MPU6050_DMP_CODE_SIZE + 1];
+    FILE *file = fopen(firmwarePath, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Failed to open DMP firmware %s\n", firmwarePath);
+        return 1;
+    }
+    size_t size = fread(firmware, 1, sizeof(firmware), file);
+    fclose(file);
+    if (size != MPU6050_DMP_CODE_SIZE) {
+        fprintf(stderr, "DMP firmware %s is %u bytes, expected %d\n", firmwarePath, (unsigned)size, MPU6050_DMP_CODE_SIZE);
+        return 1;
+    }
+
+    // reset device and wake it up
+    reset();
+    usleep(30000);
+    setSleepEnabled(false);
+
+    // disable the auxiliary I2C master so it cannot disturb the memory upload
+    setSlaveAddress(0, 0x7F);
+    setI2CMasterModeEnabled(false);
+    setSlaveAddress(0, 0x68);
+    resetI2CMaster();
+    usleep(20000);
+
+    setClockSource(MPU6050_CLOCK_PLL_ZGYRO);
+    setIntEnabled((1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT) | (1 << MPU6050_INTERRUPT_DMP_INT_BIT));
+    setRate(4); // 1 kHz / (1 + 4) = 200 Hz
+    setExternalFrameSync(MPU6050_EXT_SYNC_TEMP_OUT_L);
+    setDLPFMode(MPU6050_DLPF_BW_42);
+    setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+
+    if (!writeMemoryBlock(firmware, MPU6050_DMP_CODE_SIZE, 0, 0, true)) return 1;
+
+    uint8_t dmpUpdate[] = { 0x00, MPU6050_DMP_FIFO_RATE_DIVISOR };
+    if (!writeMemoryBlock(dmpUpdate, 2, MPU6050_DMP_FIFO_RATE_BANK, MPU6050_DMP_FIFO_RATE_ADDRESS, true)) return 2;
+
+    setDMPConfig1(MPU6050_DMP_START_ADDRESS >> 8);
+    setDMPConfig2(MPU6050_DMP_START_ADDRESS & 0xFF);
+    setOTPBankValid(false);
+
+    setMotionDetectionThreshold(2);
+    setZeroMotionDetectionThreshold(156);
+    setMotionDetectionDuration(80);
+    setZeroMotionDetectionDuration(0);
+
+    setFIFOEnabled(true);
+    resetDMP();
+    setDMPEnabled(false);
+
+    dmpPacketSize = MPU6050_DMP_PACKET_SIZE;
+
+    resetFIFO();
+    getIntStatus();
+    return 0;
+}
+
+bool MPU6050::dmpPacketAvailable() {
+    uint16_t count;
+    return dmpPacketSize > 0 && readFIFOCount(bus, devAddr, &count) && count >= dmpPacketSize;
+}
+
+uint16_t MPU6050::dmpGetFIFOPacketSize() {
+    return dmpPacketSize;
+}
+
+/** Read the newest DMP packet from the FIFO, skipping older ones.
+ * Older packets are discarded with a few large reads instead of one read per
+ * packet. A count that is not a whole number of packets means the FIFO
+ * overflowed, and a failed read leaves it misaligned: in both cases it is
+ * reset and no packet is returned.
+ * @param data Container for the packet (leave off to use dmpPacketBuffer)
+ * @return 1 if a packet was read, 0 otherwise
+ */
+uint8_t MPU6050::dmpGetCurrentFIFOPacket(uint8_t *data) {
+    if (data == 0) data = dmpPacketBuffer;
+    if (dmpPacketSize == 0) return 0;
+
+    uint16_t count;
+    if (!readFIFOCount(bus, devAddr, &count)) return 0;
+    if (count < dmpPacketSize) return 0;
+    if (count >= 1024 || count % dmpPacketSize != 0) {
+        resetFIFO();
+        return 0;
+    }
+    if (!readFIFO(bus, devAddr, NULL, count - dmpPacketSize) ||
+            !readFIFO(bus, devAddr, data, dmpPacketSize)) {
+        resetFIFO();
+        return 0;
+    }
+    return 1;
+}
+
+uint8_t MPU6050::dmpGetAccel(int32_t *data, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    data[0] = (((uint32_t)packet[28] << 24) | ((uint32_t)packet[29] << 16) | ((uint32_t)packet[30] << 8) | packet[31]);
+    data[1] = (((uint32_t)packet[32] << 24) | ((uint32_t)packet[33] << 16) | ((uint32_t)packet[34] << 8) | packet[35]);
+    data[2] = (((uint32_t)packet[36] << 24) | ((uint32_t)packet[37] << 16) | ((uint32_t)packet[38] << 8) | packet[39]);
+    return 0;
+}
+uint8_t MPU6050::dmpGetAccel(int16_t *data, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    data[0] = (packet[28] << 8) | packet[29];
+    data[1] = (packet[32] << 8) | packet[33];
+    data[2] = (packet[36] << 8) | packet[37];
+    return 0;
+}
+uint8_t MPU6050::dmpGetAccel(VectorInt16 *v, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    v->x = (packet[28] << 8) | packet[29];
+    v->y = (packet[32] << 8) | packet[33];
+    v->z = (packet[36] << 8) | packet[37];
+    return 0;
+}
+uint8_t MPU6050::dmpGetQuaternion(int32_t *data, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    data[0] = (((uint32_t)packet[0] << 24) | ((uint32_t)packet[1] << 16) | ((uint32_t)packet[2] << 8) | packet[3]);
+    data[1] = (((uint32_t)packet[4] << 24) | ((uint32_t)packet[5] << 16) | ((uint32_t)packet[6] << 8) | packet[7]);
+    data[2] = (((uint32_t)packet[8] << 24) | ((uint32_t)packet[9] << 16) | ((uint32_t)packet[10] << 8) | packet[11]);
+    data[3] = (((uint32_t)packet[12] << 24) | ((uint32_t)packet[13] << 16) | ((uint32_t)packet[14] << 8) | packet[15]);
+    return 0;
+}
+uint8_t MPU6050::dmpGetQuaternion(int16_t *data, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    data[0] = ((packet[0] << 8) | packet[1]);
+    data[1] = ((packet[4] << 8) | packet[5]);
+    data[2] = ((packet[8] << 8) | packet[9]);
+    data[3] = ((packet[12] << 8) | packet[13]);
+    return 0;
+}
+/** Get the orientation quaternion of a DMP packet.
+ * The DMP reports each component in Q30; the top 16 bits are Q14.
+ * @param q Container for the unit quaternion
+ * @param packet DMP packet (leave off to use dmpPacketBuffer)
+ * @return 0 on success
+ */
+uint8_t MPU6050::dmpGetQuaternion(Quaternion *q, const uint8_t* packet) {
+    int16_t qI[4];
+    uint8_t status = dmpGetQuaternion(qI, packet);
+    if (status == 0) {
+        q->w = (float)qI[0] / 16384.0f;
+        q->x = (float)qI[1] / 16384.0f;
+        q->y = (float)qI[2] / 16384.0f;
+        q->z = (float)qI[3] / 16384.0f;
+        return 0;
+    }
+    return status;
+}
+uint8_t MPU6050::dmpGetGyro(int32_t *data, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    data[0] = (((uint32_t)packet[16] << 24) | ((uint32_t)packet[17] << 16) | ((uint32_t)packet[18] << 8) | packet[19]);
+    data[1] = (((uint32_t)packet[20] << 24) | ((uint32_t)packet[21] << 16) | ((uint32_t)packet[22] << 8) | packet[23]);
+    data[2] = (((uint32_t)packet[24] << 24) | ((uint32_t)packet[25] << 16) | ((uint32_t)packet[26] << 8) | packet[27]);
+    return 0;
+}
+uint8_t MPU6050::dmpGetGyro(int16_t *data, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    data[0] = (packet[16] << 8) | packet[17];
+    data[1] = (packet[20] << 8) | packet[21];
+    data[2] = (packet[24] << 8) | packet[25];
+    return 0;
+}
+uint8_t MPU6050::dmpGetGyro(VectorInt16 *v, const uint8_t* packet) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    v->x = (packet[16] << 8) | packet[17];
+    v->y = (packet[20] << 8) | packet[21];
+    v->z = (packet[24] << 8) | packet[25];
+    return 0;
+}
+/** Remove gravity from a raw DMP accel vector.
+ * DMP accel is reported at 8192 LSB/g.
+ */
+uint8_t MPU6050::dmpGetLinearAccel(VectorInt16 *v, VectorInt16 *vRaw, VectorFloat *gravity) {
+    v->x = vRaw->x - gravity->x*8192;
+    v->y = vRaw->y - gravity->y*8192;
+    v->z = vRaw->z - gravity->z*8192;
+    return 0;
+}
+/** Rotate a body frame linear acceleration into the world frame.
+ */
+uint8_t MPU6050::dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, Quaternion *q) {
+    memcpy(v, vReal, sizeof(VectorInt16));
+    v->rotate(q);
+    return 0;
+}
+/** Get the gravity direction in Q14 from a DMP packet's quaternion.
+ */
+uint8_t MPU6050::dmpGetGravity(int16_t *data, const uint8_t* packet) {
+    int16_t qI[4];
+    uint8_t status = dmpGetQuaternion(qI, packet);
+    data[0] = ((int32_t)qI[1] * qI[3] - (int32_t)qI[0] * qI[2]) / 8192;
+    data[1] = ((int32_t)qI[0] * qI[1] + (int32_t)qI[2] * qI[3]) / 8192;
+    data[2] = ((int32_t)qI[0] * qI[0] - (int32_t)qI[1] * qI[1] - (int32_t)qI[2] * qI[2] + (int32_t)qI[3] * qI[3]) / 16384;
+    return status;
+}
+/** Get the unit gravity vector from an orientation quaternion.
+ */
+uint8_t MPU6050::dmpGetGravity(VectorFloat *v, Quaternion *q) {
+    v->x = 2 * (q->x*q->z - q->w*q->y);
+    v->y = 2 * (q->w*q->x + q->y*q->z);
+    v->z = q->w*q->w - q->x*q->x - q->y*q->y + q->z*q->z;
+    return 0;
+}
+/** Get Euler angles (psi, theta, phi) in radians from an orientation quaternion.
+ */
+uint8_t MPU6050::dmpGetEuler(float *data, Quaternion *q) {
+    data[0] = atan2f(2*q->x*q->y - 2*q->w*q->z, 2*q->w*q->w + 2*q->x*q->x - 1);   // psi
+    data[1] = -asinf(2*q->x*q->z + 2*q->w*q->y);                                   // theta
+    data[2] = atan2f(2*q->y*q->z - 2*q->w*q->x, 2*q->w*q->w + 2*q->z*q->z - 1);   // phi
+    return 0;
+}
+/** Get yaw, pitch and roll in radians from an orientation quaternion and its gravity vector.
+ * Pitch is unwrapped past +/-90 degrees when the sensor is upside down.
+ */
+uint8_t MPU6050::dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gravity) {
+    // yaw: (about Z axis)
+    data[0] = atan2f(2*q->x*q->y - 2*q->w*q->z, 2*q->w*q->w + 2*q->x*q->x - 1);
+    // pitch: (nose up/down, about Y axis)
+    data[1] = atan2f(gravity->x, sqrtf(gravity->y*gravity->y + gravity->z*gravity->z));
+    // roll: (tilt left/right, about X axis)
+    data[2] = atan2f(gravity->y, gravity->z);
+    if (gravity->z < 0) {
+        if (data[1] > 0) {
+            data[1] = M_PI - data[1];
+        } else {
+            data[1] = -M_PI - data[1];
+        }
+    }
+    return 0;
+}
+
+/** Copy one DMP packet into dmpPacketBuffer so the packet=0 getters decode it.
+ */
+uint8_t MPU6050::dmpProcessFIFOPacket(const unsigned char *dmpData) {
+    if (dmpPacketSize == 0) return 1;
+    memcpy(dmpPacketBuffer, dmpData, dmpPacketSize);
+    return 0;
+}
+/** Read up to numPackets DMP packets from the FIFO, keeping the last in dmpPacketBuffer.
+ * @param numPackets Maximum number of packets to read
+ * @param processed Container for the number of packets read (optional)
+ * @return 0 on success, 1 before dmpInitialize(), 2 if a FIFO read failed (the FIFO is reset)
+ */
+uint8_t MPU6050::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed) {
+    uint8_t done = 0;
+    uint8_t status = 0;
+    uint16_t count;
+
+    if (processed != NULL) *processed = 0;
+    if (dmpPacketSize == 0) return 1;
+    if (!readFIFOCount(bus, devAddr, &count)) return 2;
+    while (done < numPackets && count >= dmpPacketSize) {
+        if (!readFIFO(bus, devAddr, dmpPacketBuffer, dmpPacketSize)) {
+            resetFIFO();
+            status = 2;
+            break;
+        }
+        count -= dmpPacketSize;
+        done++;
+    }
+    if (processed != NULL) *processed = done;
+    return status;
+}
+
+#endif /* MPU6050_INCLUDE_DMP_MOTIONAPPS20 */
@@ -0,0 +1,51 @@
+// I2Cdev library collection - MPU6050 I2C device class, 6-axis MotionApps 2.0 implementation
+// Based on InvenSense MPU-6050 register map document rev. 2.0, 5/19/2011 (RM-MPU-6000A-00)
+// Linux port of the MotionApps 2.0 DMP support from https://github.com/jrowberg/i2cdevlib
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_6AXIS_MOTIONAPPS20_H_
+#define _MPU6050_6AXIS_MOTIONAPPS20_H_
+
+// The dmp*() methods are declared only with -DMPU6050_INCLUDE_DMP_MOTIONAPPS20.
+// Without it MPU6050_6Axis_MotionApps20.cpp compiles to nothing, so a plain
+// g++ *.cpp still builds; the class layout is the same either way.
+
+#include <stdint.h>
+#include "helper_3dmath.h"
+#include "MPU6050.h"
+
+// The MotionApps 2.0 firmware is InvenSense's binary image and is not part of
+// this tree. Save the 1929 byte dmpMemory[] array from i2cdevlib's
+// MPU6050_6Axis_MotionApps20.h as a raw file next to the program.
+#define MPU6050_DMP_CODE_SIZE           1929
+#define MPU6050_DMP_FIRMWARE            "dmp_motionapps20.bin"
+#define MPU6050_DMP_START_ADDRESS       0x0300  // program start address written to DMP_CFG_1/2
+#define MPU6050_DMP_FIFO_RATE_BANK      0x02    // FIFO rate divisor location inside the image
+#define MPU6050_DMP_FIFO_RATE_ADDRESS   0x16
+#define MPU6050_DMP_FIFO_RATE_DIVISOR   0x01    // 200 Hz / (1 + 1) = 100 Hz
+#define MPU6050_DMP_PACKET_SIZE         42      // quaternion, gyro and accel as 32-bit words + 2 bytes
+
+#endif /* _MPU6050_6AXIS_MOTIONAPPS20_H_ */
@@ -0,0 +1,199 @@
+/**********************************************************************
+* Filename    : BMP180.cpp
+* Description : BMP180 pressure sensor driver for Raspberry Pi.
+*               Keeps one bus handle open and the calibration cached.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+* Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/33.1.1_Barometer
+**********************************************************************/
+#include "BMP180.hpp"
+#include <stdio.h>                                          // Include standard I/O library
+#include <fcntl.h>                                          // open()
+#include <unistd.h>                                         // close(), usleep()
+#include <math.h>                                           // pow(), fabs()
+#include <sys/ioctl.h>                                      // ioctl()
+#include <linux/i2c-dev.h>                                  // I2C_SLAVE
+#include "smbus.h"                                          // SMBus and I2C_RDWR batch functions
+
+BMP180::BMP180() {
+    fd = -1;                                                // Bus not opened
+    address = BMP180_I2C_ADDRESS;                           // Default address
+    oss = 3;                                                // Highest resolution
+    b5 = 0;
+    temperature = 0;
+    pressure = 0;
+}
+
+BMP180::~BMP180() {
+    end();                                                  // Release the bus
+}
+
+// Function to open the bus once, check the chip id and cache the calibration
+int BMP180::begin(const char *bus, uint8_t address, uint8_t oversampling) {
+    int busNumber = -1;
+
+    end();                                                  // Allow calling begin() again
+    this->address = address;                                // Store the sensor address
+    oss = oversampling > 3 ? 3 : oversampling;              // Clamp the oversampling setting
+    if ((fd = open(bus, O_RDWR | O_CLOEXEC)) < 0) {         // Open the I2C bus for reading and writing
+        perror("Failed to open the i2c bus");               // Print error message
+        return BMP180_ERROR_BUS;
+    }
+    if (ioctl(fd, I2C_SLAVE, address) < 0) {                // Select the sensor for all later transfers
+        perror("Failed to acquire bus access and/or talk to slave"); // Print error message
+        end();
+        return BMP180_ERROR_BUS;
+    }
+    sscanf(bus, "/dev/i2c-%d", &busNumber);                 // Bus number for the transfer statistics
+    i2c_smbus_stats_bind(fd, busNumber, address);           // Attribute transfer statistics to the BMP180
+    if (i2c_smbus_read_byte_data(fd, BMP180_REG_CHIP_ID) != BMP180_CHIP_ID) { // Check that a BMP180 answers
+        end();
+        return BMP180_ERROR_CHIP_ID;
+    }
+    int result = readCalibration();                         // Read the calibration once
+    if (result != BMP180_OK) end();
+    return result;
+}
+
+// Function to close the bus
+void BMP180::end() {
+    if (fd < 0) return;                                     // Nothing to close
+    close(fd);                                              // Close I2C device
+    fd = -1;
+}
+
+// Function to read all 11 calibration words in one block read and validate them
+int BMP180::readCalibration() {
+    uint8_t raw[BMP180_CALIBRATION_SIZE];                   // Calibration block AC1..MD, big-endian words
+    uint16_t words[BMP180_CALIBRATION_SIZE / 2];            // Decoded words
+
+    if (i2c_smbus_read_i2c_block_data(fd, BMP180_REG_CALIBRATION, BMP180_CALIBRATION_SIZE, raw) != BMP180_CALIBRATION_SIZE) {
+        return BMP180_ERROR_BUS;                            // Block read failed or was short
+    }
+    for (int i = 0; i < BMP180_CALIBRATION_SIZE / 2; i++) {
+        words[i] = (raw[2 * i] << 8) | raw[2 * i + 1];      // Combine MSB and LSB
+        if (words[i] == 0x0000 || words[i] == 0xFFFF) {     // Datasheet: no word is 0 or 0xFFFF
+            return BMP180_ERROR_CALIBRATION;
+        }
+    }
+    ac1 = words[0];                                         // Assign coefficients in EEPROM order
+    ac2 = words[1];
+    ac3 = words[2];
+    ac4 = words[3];
+    ac5 = words[4];
+    ac6 = words[5];
+    b1 = words[6];
+    b2 = words[7];
+    mb = words[8];
+    mc = words[9];
+    md = words[10];
+    return BMP180_OK;
+}
+
+// Function to measure temperature and pressure with the cached calibration
+int BMP180::read() {
+    struct i2c_rdwr_batch batch;                            // Temperature result read plus pressure start
+    uint8_t raw[3];                                         // Result registers
+
+    if (fd < 0) return BMP180_ERROR_BUS;                    // begin() not called or failed
+    if (i2c_smbus_write_byte_data(fd, BMP180_REG_CONTROL, BMP180_CMD_TEMPERATURE) < 0) { // Request temperature reading
+        return BMP180_ERROR_BUS;
+    }
+    usleep(BMP180_TEMPERATURE_DELAY);                       // Wait for measurement
+
+    i2c_rdwr_batch_init(&batch);                            // Read the temperature and start the pressure conversion in one ioctl
+    i2c_rdwr_batch_read_reg(&batch, address, BMP180_REG_RESULT, raw, 2);
+    i2c_rdwr_batch_write_reg(&batch, address, BMP180_REG_CONTROL, BMP180_CMD_PRESSURE + (oss << 6));
+    if (i2c_rdwr_batch_submit(fd, &batch) < 0) {
+        return BMP180_ERROR_BUS;
+    }
+    int32_t ut = (raw[0] << 8) | raw[1];                    // Uncompensated temperature
+    usleep(getConversionDelay());                           // Wait for measurement
+
+    if (i2c_smbus_read_i2c_block_data(fd, BMP180_REG_RESULT, 3, raw) != 3) { // Read pressure data block
+        return BMP180_ERROR_BUS;
+    }
+    int32_t up = ((raw[0] << 16) | (raw[1] << 8) | raw[2]) >> (8 - oss); // Uncompensated pressure
+
+    temperature = computeTemperature(ut);                   // Compensate temperature first, it sets b5
+    pressure = computePressure(up);                         // Compensate pressure
+    return BMP180_OK;
+}
+
+// Function to calculate temperature given uncalibrated temperature value
+int BMP180::computeTemperature(int32_t ut) {
+    int x1, x2;                                             // Intermediate calculation variables
+    x1 = (((int) ut - (int) ac6) * (int) ac5) >> 15;        // Calculate X1
+    x2 = ((int) mc << 11) / (x1 + md);                      // Calculate X2
+    b5 = x1 + x2;                                           // Calculate B5
+    return (b5 + 8) >> 4;                                   // Return temperature in 0.1 degrees Celsius
+}
+
+// Function to calculate pressure given uncalibrated pressure value
+int BMP180::computePressure(int32_t up) {
+    return computePressure(up, oss);                        // Conversion started with the current setting
+}
+
+// Function to calculate pressure given uncalibrated pressure value and its oversampling setting
+int BMP180::computePressure(int32_t up, uint8_t oversampling) {
+    int x1, x2, x3, b3, b6, p;                              // Intermediate calculation variables
+    unsigned int b4, b7;                                    // Intermediate calculation variables
+    b6 = b5 - 4000;                                         // Calculate B6
+    x1 = (b2 * (b6 * b6) >> 12) >> 11;                      // Calculate X1
+    x2 = (ac2 * b6) >> 11;                                  // Calculate X2
+    x3 = x1 + x2;                                           // Calculate X3
+    b3 = (((((int) ac1) * 4 + x3) << oversampling) + 2) >> 2; // Calculate B3
+    x1 = (ac3 * b6) >> 13;                                  // Calculate X1
+    x2 = (b1 * ((b6 * b6) >> 12)) >> 16;                    // Calculate X2
+    x3 = ((x1 + x2) + 2) >> 2;                              // Calculate X3
+    b4 = (ac4 * (unsigned int) (x3 + 32768)) >> 15;         // Calculate B4
+    b7 = ((unsigned int) (up - b3) * (50000 >> oversampling)); // Calculate B7
+    if (b7 < 0x80000000) {                                  // Calculate pressure P
+        p = (b7 << 1) / b4;                                 // Calculate pressure P
+    } else {
+        p = (b7 / b4) << 1;                                 // Calculate pressure P
+    }
+    x1 = (p >> 8) * (p >> 8);                               // Calculate X1
+    x1 = (x1 * 3038) >> 16;                                 // Calculate X1
+    x2 = (-7357 * p) >> 16;                                 // Calculate X2
+    p += (x1 + x2 + 3791) >> 4;                             // Calculate pressure P
+    return p;                                               // Return pressure in Pa
+}
+
+// Function to calculate altitude given pressure in hPa
+float BMP180::getAltitude(float pressure, float seaLevel) {
+    float altitude;                                         // Declare altitude variable
+    altitude = 44330.0 * (1.0 - pow(pressure / seaLevel, 0.1903)); // Calculate altitude
+    altitude = fabs(altitude);                              // Take the absolute value of altitude
+    return altitude;                                        // Return altitude value
+}
+
+// Function to get the pressure conversion time for the oversampling setting
+uint32_t BMP180::getConversionDelay() {
+    return getConversionDelay(oss);
+}
+
+// Function to get the pressure conversion time for any oversampling setting
+uint32_t BMP180::getConversionDelay(uint8_t oversampling) {
+    return (2 + (3 << oversampling)) * 1000;                // 5, 8, 14 or 26 ms
+}
+
+// Function to get the open bus file descriptor
+int BMP180::getFd() {
+    return fd;
+}
+
+// Function to get the I2C address of the sensor
+uint8_t BMP180::getAddress() {
+    return address;
+}
+
+// Function to get the oversampling setting
+uint8_t BMP180::getOversampling() {
+    return oss;
+}
+
+// Function to change the oversampling setting used by the next read()
+void BMP180::setOversampling(uint8_t oversampling) {
+    oss = oversampling > 3 ? 3 : oversampling;              // Clamp the oversampling setting
+}
@@ -0,0 +1,69 @@
+/**********************************************************************
+* Filename    : BMP180.hpp
+* Description : BMP180 pressure sensor driver for Raspberry Pi.
+*               Keeps one bus handle open and the calibration cached.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+* Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/33.1.1_Barometer
+**********************************************************************/
+#ifndef _BMP180_H_                                  // Include guard to prevent multiple inclusions
+#define _BMP180_H_
+
+#include <stdint.h>                                 // Include standard integer types
+
+// Return flags of the driver functions
+#define BMP180_OK                   0               // Success flag
+#define BMP180_ERROR_BUS            -1              // I2C bus open or transfer error flag
+#define BMP180_ERROR_CHIP_ID        -2              // No BMP180 at the address flag
+#define BMP180_ERROR_CALIBRATION    -3              // Calibration EEPROM content invalid flag
+
+#define BMP180_I2C_BUS              "/dev/i2c-1"    // Default I2C bus
+#define BMP180_I2C_ADDRESS          0x77            // Default BMP180 I2C address
+#define BMP180_CHIP_ID              0x55            // Content of the chip id register
+
+// Registers and commands
+#define BMP180_REG_CALIBRATION      0xAA            // First of the 11 calibration words (AC1)
+#define BMP180_CALIBRATION_SIZE     22              // Calibration bytes, AC1 to MD
+#define BMP180_REG_CHIP_ID          0xD0            // Chip id register
+#define BMP180_REG_CONTROL          0xF4            // Measurement control register
+#define BMP180_REG_RESULT           0xF6            // First result register (MSB)
+#define BMP180_CMD_TEMPERATURE      0x2E            // Start a temperature conversion
+#define BMP180_CMD_PRESSURE         0x34            // Start a pressure conversion, oversampling in bits 7:6
+
+#define BMP180_TEMPERATURE_DELAY    4500            // Temperature conversion time in us
+#define BMP180_SEA_LEVEL_PRESSURE   1013.25         // Standard sea-level pressure in hPa
+
+class BMP180 {
+    public:
+        BMP180();                                   // Constructor, no bus access
+        ~BMP180();                                  // Destructor, closes the bus
+        BMP180(const BMP180 &) = delete;            // Owns the bus file descriptor, not copyable
+        BMP180 &operator=(const BMP180 &) = delete;
+        int begin(const char *bus = BMP180_I2C_BUS, uint8_t address = BMP180_I2C_ADDRESS, uint8_t oversampling = 3); // Open the bus, check the chip and load calibration
+        void end();                                 // Close the bus
+        int read();                                 // Measure temperature and pressure
+        int temperature;                            // Last temperature in 0.1 degrees Celsius
+        int pressure;                               // Last pressure in Pa
+        static float getAltitude(float pressure, float seaLevel = BMP180_SEA_LEVEL_PRESSURE); // Altitude in m from pressure in hPa
+
+        int computeTemperature(int32_t ut);         // Compensate a raw temperature, also updates b5
+        int computePressure(int32_t up);            // Compensate a raw pressure, needs b5 of the same sample
+        int computePressure(int32_t up, uint8_t oversampling); // Same, for a conversion started with another setting
+        uint32_t getConversionDelay();              // Pressure conversion time in us for the oversampling setting
+        static uint32_t getConversionDelay(uint8_t oversampling); // Pressure conversion time in us for any setting
+        int getFd();                                // Open bus file descriptor, -1 before begin()
+        uint8_t getAddress();                       // I2C address of the sensor
+        uint8_t getOversampling();                  // Oversampling setting 0-3
+        void setOversampling(uint8_t oversampling); // Change the oversampling setting, clamped to 0-3
+
+    private:
+        int fd;                                     // Bus file descriptor with I2C_SLAVE set
+        uint8_t address;                            // I2C address of the sensor
+        uint8_t oss;                                // Oversampling setting
+        int16_t ac1, ac2, ac3, b1, b2, mb, mc, md;  // Calibration coefficients
+        uint16_t ac4, ac5, ac6;                     // Unsigned calibration coefficients
+        int32_t b5;                                 // Temperature term shared with the pressure compensation
+        int readCalibration();                      // Read and validate the calibration block
+};
+
+#endif
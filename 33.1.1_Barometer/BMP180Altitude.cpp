@@ -0,0 +1,157 @@
+/**********************************************************************
+* Filename    : BMP180Altitude.cpp
+* Description : Altitude and vertical speed filter for BMP180 samples.
+*               Table based altitude conversion and a two state
+*               Kalman filter, optionally driven by vertical acceleration.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+* Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/33.1.1_Barometer
+**********************************************************************/
+#include "BMP180Altitude.hpp"
+#include <math.h>                                           // pow()
+
+// Altitude measurement noise in m for oversampling 0-3 (datasheet RMS noise, 0.06 to 0.03 hPa)
+static const float measurementNoise[4] = {0.5, 0.4, 0.3, 0.25};
+
+// Table of 44330 * (1 - ratio^0.1903) over the pressure / sea-level ratio, built on first use
+static const float *altitudeTable() {
+    static float table[BMP180_ALTITUDE_TABLE_SIZE];
+    static bool built = [] {                                // Thread-safe one-time initialization
+        for (int i = 0; i < BMP180_ALTITUDE_TABLE_SIZE; i++) {
+            double ratio = BMP180_ALTITUDE_RATIO_MIN + i * BMP180_ALTITUDE_RATIO_STEP;
+            table[i] = 44330.0 * (1.0 - pow(ratio, 0.1903));
+        }
+        return true;
+    }();
+    (void)built;
+    return table;
+}
+
+// Function to calculate altitude from pressure without calling pow()
+float BMP180Altitude::pressureToAltitude(float pressure, float seaLevel) {
+    const float *table = altitudeTable();
+    float ratio = pressure / (seaLevel * 100);              // Sea level in hPa, pressure in Pa
+    float position = (ratio - (float)BMP180_ALTITUDE_RATIO_MIN) * (float)(1 / BMP180_ALTITUDE_RATIO_STEP);
+    if (!(position >= 0 && position < BMP180_ALTITUDE_TABLE_SIZE - 1)) { // Outside the table, or NaN
+        return 44330.0 * (1.0 - pow(ratio, 0.1903));
+    }
+    int index = (int)position;
+    float fraction = position - index;
+    return table[index] + (table[index + 1] - table[index]) * fraction; // Linear interpolation
+}
+
+BMP180Altitude::BMP180Altitude(float seaLevel) {
+    setSeaLevel(seaLevel);
+    motionNoise = BMP180_ALTITUDE_MOTION_NOISE;
+    accelNoise = BMP180_ALTITUDE_ACCEL_NOISE;
+    reset();
+}
+
+// Function to forget the state, the next pressure sample initializes it
+void BMP180Altitude::reset() {
+    valid = false;
+    accelerationInput = false;
+    timestamp = 0;
+    acceleration = 0;
+    altitude = speed = 0;
+    p00 = p01 = p11 = 0;
+    rawAltitude = 0;
+}
+
+// Function to set the sea-level pressure in hPa
+void BMP180Altitude::setSeaLevel(float seaLevel) {
+    this->seaLevel = seaLevel;
+}
+
+// Function to set the process noise.
+// motionNoise is the random vertical acceleration assumed without an IMU: higher follows
+// climbs faster, lower smooths more. accelNoise is the noise of the fused accelerometer.
+void BMP180Altitude::setNoise(float motionNoise, float accelNoise) {
+    this->motionNoise = motionNoise;
+    this->accelNoise = accelNoise;
+}
+
+// Function to advance the state to a timestamp with a constant acceleration
+void BMP180Altitude::predict(uint64_t to, float acceleration, float noise) {
+    if (to <= timestamp) return;                            // Samples out of order are corrected in place
+    float dt = (to - timestamp) * 1e-9f;
+    float dt2 = dt * dt;
+    float q = noise * noise;
+
+    altitude += speed * dt + 0.5f * acceleration * dt2;     // Constant acceleration model
+    speed += acceleration * dt;
+    p00 += 2 * dt * p01 + dt2 * p11 + q * dt2 * dt2 / 4;    // P = F P F' + Q, white acceleration noise
+    p01 += dt * p11 + q * dt2 * dt / 2;
+    p11 += q * dt2;
+    timestamp = to;
+}
+
+// Function to correct the state with a pressure sample
+void BMP180Altitude::update(const BMP180Sample *sample) {
+    float r = measurementNoise[sample->oversampling & 3];
+    r *= r;                                                 // Measurement variance
+    rawAltitude = pressureToAltitude(sample->pressure, seaLevel);
+
+    if (!valid) {                                           // First sample: start at rest
+        altitude = rawAltitude;
+        speed = 0;
+        p00 = r;
+        p01 = 0;
+        p11 = 1;
+        timestamp = sample->timestamp;
+        valid = true;
+        return;
+    }
+
+    if (accelerationInput) {
+        predict(sample->timestamp, acceleration, accelNoise); // Hold the last acceleration
+    } else {
+        predict(sample->timestamp, 0, motionNoise);
+    }
+
+    float innovation = rawAltitude - altitude;
+    float s = p00 + r;
+    float k0 = p00 / s;                                     // Kalman gains
+    float k1 = p01 / s;
+    altitude += k0 * innovation;
+    speed += k1 * innovation;
+    p11 -= k1 * p01;                                        // P = (I - K H) P
+    p01 -= k0 * p01;
+    p00 -= k0 * p00;
+}
+
+// Function to predict with a vertical acceleration sample, for example from the MPU6050.
+// The acceleration must be in the world frame with gravity removed. Call it at the IMU rate,
+// pressure samples then correct the drift of the integrated acceleration.
+void BMP180Altitude::updateAcceleration(uint64_t timestamp, float acceleration) {
+    accelerationInput = true;
+    if (valid) {
+        predict(timestamp, this->acceleration, accelNoise); // Integrate the previous interval
+    }
+    this->acceleration = acceleration;
+}
+
+// Function to get the filtered altitude in m
+float BMP180Altitude::getAltitude() {
+    return altitude;
+}
+
+// Function to get the filtered vertical speed in m/s
+float BMP180Altitude::getVerticalSpeed() {
+    return speed;
+}
+
+// Function to get the unfiltered altitude of the last pressure sample in m
+float BMP180Altitude::getRawAltitude() {
+    return rawAltitude;
+}
+
+// Function to get the altitude variance of the estimate in m^2
+float BMP180Altitude::getAltitudeVariance() {
+    return p00;
+}
+
+// Function to check whether a pressure sample has been filtered
+bool BMP180Altitude::isValid() {
+    return valid;
+}
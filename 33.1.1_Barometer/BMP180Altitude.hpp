@@ -0,0 +1,56 @@
+/**********************************************************************
+* Filename    : BMP180Altitude.hpp
+* Description : Altitude and vertical speed filter for BMP180 samples.
+*               Table based altitude conversion and a two state
+*               Kalman filter, optionally driven by vertical acceleration.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+* Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/33.1.1_Barometer
+**********************************************************************/
+#ifndef _BMP180ALTITUDE_H_                          // Include guard to prevent multiple inclusions
+#define _BMP180ALTITUDE_H_
+
+#include <stdint.h>                                 // Include standard integer types
+#include "BMP180Sampler.hpp"                        // Include BMP180Sample
+
+#define BMP180_ALTITUDE_RATIO_MIN       0.25        // Lowest pressure / sea-level ratio in the table (about 10 km)
+#define BMP180_ALTITUDE_RATIO_MAX       1.10        // Highest pressure / sea-level ratio in the table (about -800 m)
+#define BMP180_ALTITUDE_RATIO_STEP      0.001       // Table step, linear interpolation error below 1 cm
+#define BMP180_ALTITUDE_TABLE_SIZE      851         // (MAX - MIN) / STEP + 1 entries
+#define BMP180_ALTITUDE_MOTION_NOISE    1.0         // Default random vertical acceleration in m/s^2 without an IMU
+#define BMP180_ALTITUDE_ACCEL_NOISE     0.3         // Default accelerometer noise in m/s^2
+
+class BMP180Altitude {
+    public:
+        BMP180Altitude(float seaLevel = BMP180_SEA_LEVEL_PRESSURE); // Filter for the given sea-level pressure in hPa
+        void reset();                               // Forget the state, the next sample initializes it
+        void setSeaLevel(float seaLevel);           // Sea-level pressure in hPa
+        void setNoise(float motionNoise, float accelNoise); // Process noise without and with acceleration input, m/s^2
+
+        void update(const BMP180Sample *sample);    // Correct with a pressure sample
+        void updateAcceleration(uint64_t timestamp, float acceleration); // Predict with vertical acceleration in m/s^2, up positive, gravity removed
+
+        float getAltitude();                        // Filtered altitude in m
+        float getVerticalSpeed();                   // Filtered vertical speed in m/s, up positive
+        float getRawAltitude();                     // Altitude of the last pressure sample in m
+        float getAltitudeVariance();                // Altitude variance of the estimate in m^2
+        bool isValid();                             // At least one pressure sample was filtered
+
+        static float pressureToAltitude(float pressure, float seaLevel = BMP180_SEA_LEVEL_PRESSURE); // Altitude in m from pressure in Pa, sea level in hPa
+
+    private:
+        float seaLevel;                             // Sea-level pressure in hPa
+        float motionNoise;                          // Process noise without acceleration input
+        float accelNoise;                           // Process noise with acceleration input
+        bool valid;                                 // State initialized
+        bool accelerationInput;                     // updateAcceleration() has been called
+        uint64_t timestamp;                         // Time of the state, CLOCK_MONOTONIC ns
+        float acceleration;                         // Last vertical acceleration, held between samples
+        float altitude, speed;                      // State
+        float p00, p01, p11;                        // Symmetric covariance
+        float rawAltitude;                          // Last measurement
+
+        void predict(uint64_t to, float acceleration, float noise); // Advance the state to a timestamp
+};
+
+#endif
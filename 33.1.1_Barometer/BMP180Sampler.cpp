@@ -0,0 +1,240 @@
+/**********************************************************************
+* Filename    : BMP180Sampler.cpp
+* Description : Background BMP180 sampler for Raspberry Pi.
+*               Runs the conversions as a timed state machine and
+*               publishes timestamped results without blocking callers.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+* Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/33.1.1_Barometer
+**********************************************************************/
+#include "BMP180Sampler.hpp"
+#include <time.h>                                           // clock_gettime()
+#include <errno.h>                                          // ETIMEDOUT
+#include "smbus.h"                                          // SMBus and I2C_RDWR batch functions
+
+enum {                                                      // Conversion running in the sensor
+    CONVERSION_NONE,                                        // Nothing started, or restarting after an error
+    CONVERSION_TEMPERATURE,                                 // Temperature, 2 result bytes
+    CONVERSION_PRESSURE                                     // Pressure, 3 result bytes
+};
+
+static uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+BMP180Sampler::BMP180Sampler(BMP180 *sensor) {
+    this->sensor = sensor;
+    running = false;
+    periodNs = 0;
+    temperatureEvery = BMP180_SAMPLER_TEMPERATURE_EVERY;
+    requestedOss = sensor->getOversampling();
+    head = 0;
+    tail = 0;
+    haveLatest = false;
+    dropped = 0;
+    errors = 0;
+    pthread_mutex_init(&latestLock, NULL);
+    pthread_mutex_init(&wakeLock, NULL);
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);      // Deadlines are CLOCK_MONOTONIC
+    pthread_cond_init(&wake, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+BMP180Sampler::~BMP180Sampler() {
+    stop();
+    pthread_mutex_destroy(&latestLock);
+    pthread_cond_destroy(&wake);
+    pthread_mutex_destroy(&wakeLock);
+}
+
+// Function to start the sampling thread.
+// With periodUs = 0 a new pressure conversion starts as soon as the previous one is read,
+// about 200, 125, 70 or 38 samples per second for oversampling 0-3.
+// The datasheet allows one temperature conversion per second for pressure compensation,
+// so temperatureEvery can be large at high rates; 1 measures it before every pressure.
+// While the sampler runs it is the only user of the sensor.
+bool BMP180Sampler::start(uint32_t periodUs, uint16_t temperatureEvery) {
+    if (running) return true;
+    if (sensor->getFd() < 0) return false;                  // begin() not called or failed
+    periodNs = (uint64_t)periodUs * 1000;
+    this->temperatureEvery = temperatureEvery > 0 ? temperatureEvery : 1;
+    head = 0;
+    tail = 0;
+    haveLatest = false;
+    dropped = 0;
+    errors = 0;
+    running = true;
+    if (pthread_create(&thread, NULL, run, this) != 0) {
+        running = false;
+        return false;
+    }
+    return true;
+}
+
+// Function to stop the sampling thread, buffered samples can still be read
+void BMP180Sampler::stop() {
+    if (!running) return;
+    pthread_mutex_lock(&wakeLock);
+    running = false;
+    pthread_cond_signal(&wake);                             // Interrupt the current wait
+    pthread_mutex_unlock(&wakeLock);
+    pthread_join(thread, NULL);
+}
+
+// Function to copy the oldest buffered samples, lock-free with one consumer
+uint32_t BMP180Sampler::read(BMP180Sample *samples, uint32_t maxSamples) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t n = head.load(std::memory_order_acquire) - t;
+    if (n > maxSamples) n = maxSamples;
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = ring[(t + i) & (BMP180_SAMPLER_RING_SIZE - 1)];
+    }
+    tail.store(t + n, std::memory_order_release);
+    return n;
+}
+
+// Function to get the number of buffered samples
+uint32_t BMP180Sampler::available() {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+}
+
+// Function to copy the newest sample, any number of threads may call it
+bool BMP180Sampler::getLatest(BMP180Sample *sample) {
+    pthread_mutex_lock(&latestLock);
+    bool valid = haveLatest;
+    if (valid) *sample = latest;
+    pthread_mutex_unlock(&latestLock);
+    return valid;
+}
+
+// Function to change the oversampling setting, applied at the next pressure conversion
+void BMP180Sampler::setOversampling(uint8_t oversampling) {
+    requestedOss = oversampling > 3 ? 3 : oversampling;
+}
+
+// Function to get the number of samples lost because the ring buffer was full
+uint32_t BMP180Sampler::getDroppedSamples() {
+    return dropped;
+}
+
+// Function to get the number of failed transfers
+uint32_t BMP180Sampler::getBusErrors() {
+    return errors;
+}
+
+void *BMP180Sampler::run(void *arg) {
+    ((BMP180Sampler *)arg)->loop();
+    return NULL;
+}
+
+// Function to sleep until a CLOCK_MONOTONIC deadline in ns
+// Returns: false if stop() was called before or during the wait
+bool BMP180Sampler::waitUntil(uint64_t deadline) {
+    struct timespec ts;
+    ts.tv_sec = deadline / 1000000000ULL;
+    ts.tv_nsec = deadline % 1000000000ULL;
+    pthread_mutex_lock(&wakeLock);
+    while (running && pthread_cond_timedwait(&wake, &wakeLock, &ts) != ETIMEDOUT); // Sleep until due or stopped
+    bool keepRunning = running;
+    pthread_mutex_unlock(&wakeLock);
+    return keepRunning;
+}
+
+// Function to append a sample to the ring buffer and make it the latest one
+void BMP180Sampler::publish(const BMP180Sample *sample) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= BMP180_SAMPLER_RING_SIZE) {
+        dropped++;                                          // Consumer too slow, keep the older samples
+    } else {
+        ring[h & (BMP180_SAMPLER_RING_SIZE - 1)] = *sample;
+        head.store(h + 1, std::memory_order_release);
+    }
+    pthread_mutex_lock(&latestLock);
+    latest = *sample;
+    haveLatest = true;
+    pthread_mutex_unlock(&latestLock);
+}
+
+// Conversion state machine.
+// Each step sleeps until the running conversion is done, then reads its result and starts
+// the next conversion in the same I2C_RDWR transfer, so the sensor never sits idle.
+// When a pressure period is set and the next pressure sample is not due yet, the start is
+// sent on its own once the period has elapsed.
+void BMP180Sampler::loop() {
+    struct i2c_rdwr_batch batch;                            // Result read plus next conversion start
+    uint8_t raw[3];                                         // Result registers
+    int fd = sensor->getFd();
+    uint8_t address = sensor->getAddress();
+    int conversion = CONVERSION_NONE;                       // Conversion running in the sensor
+    uint8_t conversionOss = 0;                              // Its oversampling setting
+    uint64_t started = 0;                                   // Its start time
+    uint64_t ready = monotonicNs();                         // Its end time
+    uint64_t nextPressure = ready;                          // Earliest start of the next pressure conversion
+    uint16_t pressureCount = 0;                             // Pressure conversions since the last temperature
+    int32_t temperature = 0;                                // Last compensated temperature
+
+    while (running) {
+        if (!waitUntil(ready)) break;                       // Wait for the running conversion
+
+        bool temperatureDue = conversion == CONVERSION_NONE || pressureCount >= temperatureEvery;
+        uint8_t nextOss = requestedOss;
+        uint8_t command = temperatureDue ? BMP180_CMD_TEMPERATURE : BMP180_CMD_PRESSURE + (nextOss << 6);
+        uint64_t startAt = temperatureDue || nextPressure < ready ? ready : nextPressure;
+        bool chained = startAt == ready;                    // Start the next conversion right away
+
+        i2c_rdwr_batch_init(&batch);
+        if (conversion != CONVERSION_NONE) {
+            i2c_rdwr_batch_read_reg(&batch, address, BMP180_REG_RESULT, raw, conversion == CONVERSION_PRESSURE ? 3 : 2);
+        }
+        if (chained) {
+            i2c_rdwr_batch_write_reg(&batch, address, BMP180_REG_CONTROL, command);
+        }
+        if (batch.nmsgs > 0 && i2c_rdwr_batch_submit(fd, &batch) < 0) {
+            errors++;                                       // Restart with a temperature conversion
+            conversion = CONVERSION_NONE;
+            ready = monotonicNs() + BMP180_SAMPLER_RETRY_DELAY * 1000ULL;
+            continue;
+        }
+        uint64_t now = monotonicNs();
+
+        if (conversion == CONVERSION_TEMPERATURE) {
+            temperature = sensor->computeTemperature((raw[0] << 8) | raw[1]); // Updates b5 for the pressure
+        } else if (conversion == CONVERSION_PRESSURE) {
+            BMP180Sample sample;
+            int32_t up = ((raw[0] << 16) | (raw[1] << 8) | raw[2]) >> (8 - conversionOss);
+            sample.timestamp = started + BMP180::getConversionDelay(conversionOss) * 500ULL; // Middle of the conversion
+            sample.temperature = temperature;
+            sample.pressure = sensor->computePressure(up, conversionOss);
+            sample.oversampling = conversionOss;
+            publish(&sample);
+        }
+
+        if (!chained) {
+            if (!waitUntil(startAt)) break;                 // Hold the next pressure sample to the period
+            if (i2c_smbus_write_byte_data(fd, BMP180_REG_CONTROL, command) < 0) {
+                errors++;
+                conversion = CONVERSION_NONE;
+                ready = monotonicNs() + BMP180_SAMPLER_RETRY_DELAY * 1000ULL;
+                continue;
+            }
+            now = monotonicNs();
+        }
+
+        started = now;
+        if (temperatureDue) {
+            conversion = CONVERSION_TEMPERATURE;
+            pressureCount = 0;
+            ready = started + BMP180_TEMPERATURE_DELAY * 1000ULL;
+        } else {
+            conversion = CONVERSION_PRESSURE;
+            conversionOss = nextOss;
+            pressureCount++;
+            nextPressure = (periodNs > 0 ? startAt : started) + periodNs;
+            ready = started + BMP180::getConversionDelay(conversionOss) * 1000ULL;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**********************************************************************
+* Filename    : BMP180Sampler.hpp
+* Description : Background BMP180 sampler for Raspberry Pi.
+*               Runs the conversions as a timed state machine and
+*               publishes timestamped results without blocking callers.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+* Reference   : https://github.com/Freenove/Freenove_Complete_Starter_Kit_for_Raspberry_Pi/tree/main/Code/C_Code/33.1.1_Barometer
+**********************************************************************/
+#ifndef _BMP180SAMPLER_H_                           // Include guard to prevent multiple inclusions
+#define _BMP180SAMPLER_H_
+
+#include <stdint.h>                                 // Include standard integer types
+#include <pthread.h>                                // Include POSIX threads
+#include <atomic>                                   // Include atomic counters
+#include "BMP180.hpp"                               // Include BMP180 driver
+
+#define BMP180_SAMPLER_RING_SIZE        256         // Ring buffer capacity in samples, power of two
+#define BMP180_SAMPLER_TEMPERATURE_EVERY 16         // Default pressure samples per temperature conversion
+#define BMP180_SAMPLER_RETRY_DELAY      100000      // Wait in us after a bus error before restarting
+
+struct BMP180Sample {
+    uint64_t timestamp;                             // Middle of the pressure conversion, CLOCK_MONOTONIC ns
+    int32_t temperature;                            // Temperature in 0.1 degrees Celsius
+    int32_t pressure;                               // Pressure in Pa
+    uint8_t oversampling;                           // Oversampling setting of this conversion
+};
+
+class BMP180Sampler {
+    public:
+        BMP180Sampler(BMP180 *sensor);              // Sampler for a sensor that begin() succeeded on
+        ~BMP180Sampler();                           // Destructor, stops the thread
+
+        bool start(uint32_t periodUs = 0, uint16_t temperatureEvery = BMP180_SAMPLER_TEMPERATURE_EVERY); // Start sampling, period 0 = maximum rate
+        void stop();                                // Stop sampling
+
+        uint32_t read(BMP180Sample *samples, uint32_t maxSamples); // Take the oldest buffered samples
+        uint32_t available();                       // Number of buffered samples
+        bool getLatest(BMP180Sample *sample);       // Copy the newest sample without consuming it
+
+        void setOversampling(uint8_t oversampling); // Change the oversampling setting of the next conversion
+        uint32_t getDroppedSamples();               // Samples lost because the ring buffer was full
+        uint32_t getBusErrors();                    // Failed transfers, each restarts the state machine
+
+    private:
+        BMP180 *sensor;                             // Driver, only used by the thread while running
+        pthread_t thread;                           // Sampling thread
+        std::atomic<bool> running;                  // Thread keeps running while true
+        pthread_mutex_t wakeLock;                   // Guards the waits against stop()
+        pthread_cond_t wake;                        // Wakes the thread early on stop()
+        uint64_t periodNs;                          // Pressure sample period, 0 = back to back
+        uint16_t temperatureEvery;                  // Pressure samples between temperature conversions
+        std::atomic<uint8_t> requestedOss;          // Oversampling setting for the next pressure conversion
+
+        BMP180Sample ring[BMP180_SAMPLER_RING_SIZE]; // Published samples
+        std::atomic<uint32_t> head;                 // Next slot written by the thread
+        std::atomic<uint32_t> tail;                 // Next slot read by the consumer
+        pthread_mutex_t latestLock;                 // Guards latest
+        BMP180Sample latest;                        // Newest sample
+        bool haveLatest;                            // latest holds a sample
+        std::atomic<uint32_t> dropped;              // Ring buffer overruns
+        std::atomic<uint32_t> errors;               // Bus errors
+
+        static void *run(void *arg);                // Thread entry
+        bool waitUntil(uint64_t deadline);          // Sleep until a CLOCK_MONOTONIC time, false once stopped
+        void loop();                                // Conversion state machine
+        void publish(const BMP180Sample *sample);   // Append to the ring buffer and update latest
+};
+
+#endif
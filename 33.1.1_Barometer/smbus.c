@@ -23,6 +23,10 @@
 
 #include <errno.h>
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
 #include "smbus.h"
 #include <sys/ioctl.h>
 #include <linux/types.h>
@@ -38,10 +42,373 @@
 #define I2C_FUNC_SMBUS_PEC I2C_FUNC_SMBUS_HWPEC_CALC
 #endif
 
+/* Transaction statistics */
+
+#define STATS_BUCKETS	88	/* 4 per power of two, 1 us to 8 s */
+#define STATS_DEVICES	32	/* distinct (bus, address) pairs */
+#define STATS_FILES	1024	/* file descriptors that can be bound */
+
+struct i2c_smbus_stats {
+	__u32 count;
+	__u32 errors;
+	__u32 naks;
+	__u64 bytes;
+	__u64 total_ns;
+	__u32 min_ns, max_ns;
+	__u32 histogram[STATS_BUCKETS];
+};
+
+struct i2c_smbus_stats_device {
+	int bus;
+	int address;
+	struct i2c_smbus_stats *command[256];
+};
+
+static int stats_enabled;
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct i2c_smbus_stats_device stats_devices[STATS_DEVICES];
+static int stats_device_count;
+static struct {
+	int bound;
+	int bus;
+	int address;
+} stats_files[STATS_FILES];
+
+static pthread_t snapshot_thread;
+static int snapshot_running;
+static pthread_mutex_t snapshot_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t snapshot_wake;
+static char snapshot_path[256];
+static unsigned int snapshot_interval_ms;
+
+static __u64 monotonic_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (__u64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Log-linear buckets in 1.024 us units, two significant bits per bucket as
+   in HdrHistogram: every bucket is within 25% of its neighbours. */
+static int latency_bucket(__u64 ns)
+{
+	__u64 units = ns >> 10;
+	int magnitude, bucket;
+
+	if (units < 4)
+		return units;
+	magnitude = 63 - __builtin_clzll(units);
+	bucket = (magnitude - 1) * 4 + ((units >> (magnitude - 2)) & 3);
+	return bucket < STATS_BUCKETS ? bucket : STATS_BUCKETS - 1;
+}
+
+static __u64 bucket_limit_ns(int bucket)
+{
+	bucket++;
+	if (bucket < 4)
+		return (__u64)bucket << 10;
+	return ((__u64)(4 + bucket % 4) << (bucket / 4 - 1)) << 10;
+}
+
+static __u64 percentile_ns(const struct i2c_smbus_stats *s, double fraction)
+{
+	__u64 target = (__u64)(s->count * fraction + 0.999999);
+	__u64 seen = 0;
+	int b;
+
+	if (target == 0)
+		target = 1;
+	for (b = 0; b < STATS_BUCKETS; b++) {
+		seen += s->histogram[b];
+		if (seen >= target) {
+			__u64 limit = bucket_limit_ns(b);
+			return limit < s->max_ns ? limit : s->max_ns;
+		}
+	}
+	return s->max_ns;
+}
+
+static struct i2c_smbus_stats *stats_entry(int file, int address,
+					   __u8 command)
+{
+	struct i2c_smbus_stats_device *dev = NULL;
+	int bus = -1;
+	int i;
+
+	if (file >= 0 && file < STATS_FILES && stats_files[file].bound) {
+		bus = stats_files[file].bus;
+		if (address < 0)
+			address = stats_files[file].address;
+	}
+	for (i = 0; i < stats_device_count; i++) {
+		if (stats_devices[i].bus == bus &&
+		    stats_devices[i].address == address) {
+			dev = &stats_devices[i];
+			break;
+		}
+	}
+	if (!dev) {
+		if (stats_device_count == STATS_DEVICES)
+			return NULL;
+		dev = &stats_devices[stats_device_count++];
+		dev->bus = bus;
+		dev->address = address;
+	}
+	if (!dev->command[command])
+		dev->command[command] = (struct i2c_smbus_stats *)
+			calloc(1, sizeof(struct i2c_smbus_stats));
+	return dev->command[command];
+}
+
+static void stats_account(int file, int address, __u8 command, __u32 bytes,
+			  __s32 err, __u64 start_ns)
+{
+	__u64 ns = monotonic_ns() - start_ns;
+	struct i2c_smbus_stats *s;
+
+	if (ns > 0xFFFFFFFFULL)
+		ns = 0xFFFFFFFFULL;
+
+	pthread_mutex_lock(&stats_lock);
+	s = stats_entry(file, address, command);
+	if (s) {
+		if (s->count == 0 || ns < s->min_ns)
+			s->min_ns = ns;
+		if (ns > s->max_ns)
+			s->max_ns = ns;
+		s->count++;
+		s->total_ns += ns;
+		s->histogram[latency_bucket(ns)]++;
+		if (err < 0) {
+			s->errors++;
+			/* bcm2835 reports a missing ACK as EREMOTEIO */
+			if (err == -EREMOTEIO || err == -ENXIO)
+				s->naks++;
+		} else {
+			s->bytes += bytes;
+		}
+	}
+	pthread_mutex_unlock(&stats_lock);
+}
+
+static void stats_record(int file, __u8 command, int size,
+			 const union i2c_smbus_data *data, __s32 err,
+			 __u64 start_ns)
+{
+	__u32 bytes;
+
+	switch (size) {
+	case I2C_SMBUS_QUICK:
+		bytes = 0;
+		break;
+	case I2C_SMBUS_WORD_DATA:
+	case I2C_SMBUS_PROC_CALL:
+		bytes = 2;
+		break;
+	case I2C_SMBUS_BLOCK_DATA:
+	case I2C_SMBUS_I2C_BLOCK_BROKEN:
+	case I2C_SMBUS_I2C_BLOCK_DATA:
+	case I2C_SMBUS_BLOCK_PROC_CALL:
+		bytes = data ? data->block[0] : 0;
+		break;
+	default:
+		bytes = 1;
+		break;
+	}
+	stats_account(file, -1, command, bytes, err, start_ns);
+}
+
+void i2c_smbus_stats_enable(int enable)
+{
+	stats_enabled = enable;
+}
+
+void i2c_smbus_stats_bind(int file, int bus, __u8 address)
+{
+	if (file < 0 || file >= STATS_FILES)
+		return;
+	pthread_mutex_lock(&stats_lock);
+	stats_files[file].bound = 1;
+	stats_files[file].bus = bus;
+	stats_files[file].address = address;
+	pthread_mutex_unlock(&stats_lock);
+}
+
+void i2c_smbus_stats_reset(void)
+{
+	int i, c;
+
+	pthread_mutex_lock(&stats_lock);
+	for (i = 0; i < stats_device_count; i++)
+		for (c = 0; c < 256; c++)
+			if (stats_devices[i].command[c])
+				memset(stats_devices[i].command[c], 0,
+				       sizeof(struct i2c_smbus_stats));
+	pthread_mutex_unlock(&stats_lock);
+}
+
+void i2c_smbus_stats_dump(FILE *out)
+{
+	int i, c;
+
+	fprintf(out, "%4s %4s %4s %9s %7s %7s %10s %9s %9s %9s %9s\n",
+		"bus", "addr", "cmd", "count", "errors", "naks", "bytes",
+		"avg us", "p50 us", "p99 us", "max us");
+	pthread_mutex_lock(&stats_lock);
+	for (i = 0; i < stats_device_count; i++) {
+		const struct i2c_smbus_stats_device *dev = &stats_devices[i];
+
+		for (c = 0; c < 256; c++) {
+			const struct i2c_smbus_stats *s = dev->command[c];
+
+			if (!s || s->count == 0)
+				continue;
+			fprintf(out, "%4d 0x%02x 0x%02x %9u %7u %7u %10llu "
+				"%9.1f %9.1f %9.1f %9.1f\n",
+				dev->bus, dev->address & 0xFF, c, s->count,
+				s->errors, s->naks,
+				(unsigned long long)s->bytes,
+				s->total_ns / 1000.0 / s->count,
+				percentile_ns(s, 0.5) / 1000.0,
+				percentile_ns(s, 0.99) / 1000.0,
+				s->max_ns / 1000.0);
+		}
+	}
+	pthread_mutex_unlock(&stats_lock);
+}
+
+/* One line of JSON: a CLOCK_REALTIME timestamp and one object per
+   (bus, address, command) with the raw counters, percentiles and the
+   non-empty histogram buckets as [upper bound ns, count]. Unbound file
+   descriptors are reported with bus and address -1. */
+void i2c_smbus_stats_snapshot(FILE *out)
+{
+	struct timespec now;
+	int i, c, b, first = 1;
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	fprintf(out, "{\"time\":%lld.%03ld,\"commands\":[",
+		(long long)now.tv_sec, now.tv_nsec / 1000000);
+	pthread_mutex_lock(&stats_lock);
+	for (i = 0; i < stats_device_count; i++) {
+		const struct i2c_smbus_stats_device *dev = &stats_devices[i];
+
+		for (c = 0; c < 256; c++) {
+			const struct i2c_smbus_stats *s = dev->command[c];
+			int first_bucket = 1;
+
+			if (!s || s->count == 0)
+				continue;
+			fprintf(out, "%s{\"bus\":%d,\"addr\":%d,\"cmd\":%d,"
+				"\"count\":%u,\"errors\":%u,\"naks\":%u,"
+				"\"bytes\":%llu,\"total_ns\":%llu,"
+				"\"min_ns\":%u,\"max_ns\":%u,\"p50_ns\":%llu,"
+				"\"p99_ns\":%llu,\"histogram\":[",
+				first ? "" : ",", dev->bus, dev->address, c,
+				s->count, s->errors, s->naks,
+				(unsigned long long)s->bytes,
+				(unsigned long long)s->total_ns,
+				s->min_ns, s->max_ns,
+				(unsigned long long)percentile_ns(s, 0.5),
+				(unsigned long long)percentile_ns(s, 0.99));
+			for (b = 0; b < STATS_BUCKETS; b++) {
+				if (!s->histogram[b])
+					continue;
+				fprintf(out, "%s[%llu,%u]",
+					first_bucket ? "" : ",",
+					(unsigned long long)bucket_limit_ns(b),
+					s->histogram[b]);
+				first_bucket = 0;
+			}
+			fprintf(out, "]}");
+			first = 0;
+		}
+	}
+	pthread_mutex_unlock(&stats_lock);
+	fprintf(out, "]}\n");
+	fflush(out);
+}
+
+static void *snapshot_run(void *arg)
+{
+	struct timespec deadline;
+
+	(void)arg;
+	pthread_mutex_lock(&snapshot_lock);
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	while (snapshot_running) {
+		FILE *out;
+
+		deadline.tv_sec += snapshot_interval_ms / 1000;
+		deadline.tv_nsec += (snapshot_interval_ms % 1000) * 1000000L;
+		if (deadline.tv_nsec >= 1000000000L) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+		while (snapshot_running &&
+		       pthread_cond_timedwait(&snapshot_wake, &snapshot_lock,
+					      &deadline) != ETIMEDOUT)
+			;
+		if (!snapshot_running)
+			break;
+
+		pthread_mutex_unlock(&snapshot_lock);
+		out = fopen(snapshot_path, "a");
+		if (out) {
+			i2c_smbus_stats_snapshot(out);
+			fclose(out);
+		}
+		pthread_mutex_lock(&snapshot_lock);
+	}
+	pthread_mutex_unlock(&snapshot_lock);
+	return NULL;
+}
+
+int i2c_smbus_stats_start_snapshots(const char *path,
+				    unsigned int interval_ms)
+{
+	pthread_condattr_t attr;
+
+	i2c_smbus_stats_stop_snapshots();
+	strncpy(snapshot_path, path, sizeof(snapshot_path) - 1);
+	snapshot_path[sizeof(snapshot_path) - 1] = 0;
+	snapshot_interval_ms = interval_ms > 0 ? interval_ms : 1;
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&snapshot_wake, &attr);
+	pthread_condattr_destroy(&attr);
+
+	stats_enabled = 1;
+	snapshot_running = 1;
+	if (pthread_create(&snapshot_thread, NULL, snapshot_run, NULL)) {
+		snapshot_running = 0;
+		pthread_cond_destroy(&snapshot_wake);
+		return -1;
+	}
+	return 0;
+}
+
+void i2c_smbus_stats_stop_snapshots(void)
+{
+	pthread_mutex_lock(&snapshot_lock);
+	if (!snapshot_running) {
+		pthread_mutex_unlock(&snapshot_lock);
+		return;
+	}
+	snapshot_running = 0;
+	pthread_cond_signal(&snapshot_wake);
+	pthread_mutex_unlock(&snapshot_lock);
+	pthread_join(snapshot_thread, NULL);
+	pthread_cond_destroy(&snapshot_wake);
+}
+
 __s32 i2c_smbus_access(int file, char read_write, __u8 command,
 		       int size, union i2c_smbus_data *data)
 {
 	struct i2c_smbus_ioctl_data args;
+	__u64 start = 0;
 	__s32 err;
 
 	args.read_write = read_write;
@@ -49,9 +416,13 @@ __s32 i2c_smbus_access(int file, char read_write, __u8 command,
 	args.size = size;
 	args.data = data;
 
+	if (stats_enabled)
+		start = monotonic_ns();
 	err = ioctl(file, I2C_SMBUS, &args);
 	if (err == -1)
 		err = -errno;
+	if (stats_enabled)
+		stats_record(file, command, size, data, err, start);
 	return err;
 }
 
@@ -223,3 +594,132 @@ __s32 i2c_smbus_block_process_call(int file, __u8 command, __u8 length,
 		values[i-1] = data.block[i];
 	return data.block[0];
 }
+
+/* I2C_RDWR message batches */
+
+#ifndef I2C_RDWR_IOCTL_MAX_MSGS
+#define I2C_RDWR_IOCTL_MAX_MSGS 42
+#endif
+
+void i2c_rdwr_batch_init(struct i2c_rdwr_batch *batch)
+{
+	batch->nmsgs = 0;
+}
+
+static int i2c_rdwr_batch_add(struct i2c_rdwr_batch *batch, __u16 addr,
+			      __u16 flags, __u8 *buf, __u16 len, int chained)
+{
+	int i = batch->nmsgs;
+
+	if (i >= I2C_RDWR_BATCH_MAX)
+		return -1;
+	batch->msgs[i].addr = addr;
+	batch->msgs[i].flags = flags;
+	batch->msgs[i].len = len;
+	batch->msgs[i].buf = buf;
+	batch->chained[i] = chained;
+	batch->results[i] = 0;
+	batch->nmsgs++;
+	return i;
+}
+
+int i2c_rdwr_batch_write(struct i2c_rdwr_batch *batch, __u16 addr,
+			 const __u8 *buf, __u16 len)
+{
+	return i2c_rdwr_batch_add(batch, addr, 0, (__u8 *)buf, len, 0);
+}
+
+int i2c_rdwr_batch_read(struct i2c_rdwr_batch *batch, __u16 addr, __u8 *buf,
+			__u16 len)
+{
+	return i2c_rdwr_batch_add(batch, addr, I2C_M_RD, buf, len, 0);
+}
+
+int i2c_rdwr_batch_write_reg(struct i2c_rdwr_batch *batch, __u16 addr,
+			     __u8 command, __u8 value)
+{
+	int i = batch->nmsgs;
+
+	if (i >= I2C_RDWR_BATCH_MAX)
+		return -1;
+	batch->data[i][0] = command;
+	batch->data[i][1] = value;
+	return i2c_rdwr_batch_add(batch, addr, 0, batch->data[i], 2, 0);
+}
+
+int i2c_rdwr_batch_read_reg(struct i2c_rdwr_batch *batch, __u16 addr,
+			    __u8 command, __u8 *buf, __u16 len)
+{
+	int i = batch->nmsgs;
+
+	if (i + 1 >= I2C_RDWR_BATCH_MAX)
+		return -1;
+	batch->data[i][0] = command;
+	i2c_rdwr_batch_add(batch, addr, 0, batch->data[i], 1, 1);
+	return i2c_rdwr_batch_add(batch, addr, I2C_M_RD, buf, len, 0);
+}
+
+static __s32 i2c_rdwr_batch_chunk(int file, struct i2c_rdwr_batch *batch,
+				  int first, int count)
+{
+	struct i2c_rdwr_ioctl_data args;
+	__u64 start = 0;
+	__u32 bytes = 0;
+	__s32 err;
+	int i;
+
+	args.msgs = &batch->msgs[first];
+	args.nmsgs = count;
+
+	if (stats_enabled)
+		start = monotonic_ns();
+	err = ioctl(file, I2C_RDWR, &args);
+	if (err == -1)
+		err = -errno;
+	for (i = first; i < first + count; i++) {
+		batch->results[i] = err < 0 ? err : batch->msgs[i].len;
+		bytes += batch->msgs[i].len;
+	}
+	if (stats_enabled) {
+		struct i2c_msg *msg = &batch->msgs[first];
+
+		/* A write's first byte is the register; reads and empty
+		   writes carry none */
+		stats_account(file, msg->addr,
+			      !(msg->flags & I2C_M_RD) && msg->len > 0 ?
+			      msg->buf[0] : 0,
+			      bytes, err, start);
+	}
+	return err;
+}
+
+/* Submits the batch as few I2C_RDWR ioctls as the kernel allows. Chunks are
+   split at I2C_RDWR_IOCTL_MAX_MSGS messages, never between a register
+   pointer write and its repeated-start read. A failed chunk reports -errno
+   for each of its messages (the kernel does not say which one failed) and
+   stops the batch; later messages report -ECANCELED.
+   Returns the number of messages transferred, or -errno of the failure. */
+__s32 i2c_rdwr_batch_submit(int file, struct i2c_rdwr_batch *batch)
+{
+	int first = 0;
+	__s32 err;
+
+	while (first < batch->nmsgs) {
+		int count = batch->nmsgs - first;
+		int i;
+
+		if (count > I2C_RDWR_IOCTL_MAX_MSGS) {
+			count = I2C_RDWR_IOCTL_MAX_MSGS;
+			if (batch->chained[first + count - 1])
+				count--;
+		}
+		err = i2c_rdwr_batch_chunk(file, batch, first, count);
+		if (err < 0) {
+			for (i = first + count; i < batch->nmsgs; i++)
+				batch->results[i] = -ECANCELED;
+			return err;
+		}
+		first += count;
+	}
+	return batch->nmsgs;
+}
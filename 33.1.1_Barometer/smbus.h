@@ -23,6 +23,7 @@
 #ifndef LIB_I2C_SMBUS_H
 #define LIB_I2C_SMBUS_H
 
+#include <stdio.h>
 #include <linux/types.h>
 #include <linux/i2c.h>
 
@@ -57,4 +58,45 @@ extern __s32 i2c_smbus_write_i2c_block_data(int file, __u8 command, __u8 length,
 extern __s32 i2c_smbus_block_process_call(int file, __u8 command, __u8 length,
 					  __u8 *values);
 
+/* Batches of plain I2C messages, possibly to several addresses, submitted
+   with as few I2C_RDWR ioctls as possible. Buffers passed to the batch must
+   stay valid until i2c_rdwr_batch_submit() returns. The add functions
+   return the message index (for results[]) or -1 if the batch is full;
+   i2c_rdwr_batch_read_reg() returns the index of its read message. */
+#define I2C_RDWR_BATCH_MAX	128
+
+struct i2c_rdwr_batch {
+	int nmsgs;
+	struct i2c_msg msgs[I2C_RDWR_BATCH_MAX];
+	__s32 results[I2C_RDWR_BATCH_MAX];	/* bytes moved or -errno */
+	__u8 chained[I2C_RDWR_BATCH_MAX];	/* must share a chunk with the next */
+	__u8 data[I2C_RDWR_BATCH_MAX][2];	/* register/value bytes of *_reg */
+};
+
+extern void i2c_rdwr_batch_init(struct i2c_rdwr_batch *batch);
+extern int i2c_rdwr_batch_write(struct i2c_rdwr_batch *batch, __u16 addr,
+				const __u8 *buf, __u16 len);
+extern int i2c_rdwr_batch_read(struct i2c_rdwr_batch *batch, __u16 addr,
+			       __u8 *buf, __u16 len);
+extern int i2c_rdwr_batch_write_reg(struct i2c_rdwr_batch *batch, __u16 addr,
+				    __u8 command, __u8 value);
+extern int i2c_rdwr_batch_read_reg(struct i2c_rdwr_batch *batch, __u16 addr,
+				   __u8 command, __u8 *buf, __u16 len);
+extern __s32 i2c_rdwr_batch_submit(int file, struct i2c_rdwr_batch *batch);
+
+/* Opt-in transaction statistics per (bus, address, command). Off by default;
+   when off, a transfer costs one extra branch. Bind each file descriptor to
+   its bus number and slave address so the counters can be attributed. */
+extern void i2c_smbus_stats_enable(int enable);
+extern void i2c_smbus_stats_bind(int file, int bus, __u8 address);
+extern void i2c_smbus_stats_reset(void);
+extern void i2c_smbus_stats_dump(FILE *out);
+extern void i2c_smbus_stats_snapshot(FILE *out);
+
+/* Appends an i2c_smbus_stats_snapshot() line to path every interval_ms.
+   Returns 0 on success, -1 if the thread could not be started. */
+extern int i2c_smbus_stats_start_snapshots(const char *path,
+					   unsigned int interval_ms);
+extern void i2c_smbus_stats_stop_snapshots(void);
+
 #endif /* LIB_I2C_SMBUS_H */
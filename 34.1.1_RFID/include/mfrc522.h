@@ -202,6 +202,12 @@ typedef enum{
 
 #define MFRC522_MAX_LEN					16
 
+//Command completion wait in MFRC522_ToCard
+#define MFRC522_TOCARD_TIMEOUT			25000  // us, longest M1 card exchange (the chip timer ends a missing card at 15 ms)
+#define MFRC522_POLL_FAST				8      // CommIrqReg polls without sleeping, covers a short exchange
+#define MFRC522_POLL_MIN_DELAY			50     // us, first sleep between slower polls
+#define MFRC522_POLL_MAX_DELAY			1000   // us, longest sleep between polls
+
 /**
  * Public functions
  */
@@ -239,6 +245,49 @@ extern MFRC522_Status_t MFRC522_Check(uint8_t* id);
  */
 extern MFRC522_Status_t MFRC522_Compare(uint8_t* CardID, uint8_t* CompareID);
 
+/**
+ * Wait for command completion on the IRQ pin instead of polling CommIrqReg
+ * The IRQ pin of the module must be wired to a GPIO of the host.
+ * MFRC522_ToCard() then routes only its completion interrupts to the pin and
+ * sleeps on the falling edge: no SPI traffic and no CPU while the card answers.
+ *
+ * Parameters:
+ * 	- unsigned int gpio:
+ * 		BCM number of the GPIO wired to IRQ
+ *
+ * Returns 0 on success, -1 if the GPIO line cannot be requested
+ */
+extern int MFRC522_EnableIrq(unsigned int gpio);
+
+/**
+ * Release the IRQ GPIO and go back to polling
+ */
+extern void MFRC522_DisableIrq(void);
+
+/**
+ * Kernel timestamp of the IRQ edge that completed the last command
+ *
+ * Returns CLOCK_MONOTONIC time in ns, or 0 if the last command completed by polling
+ */
+extern uint64_t MFRC522_GetCompletionTime(void);
+
+/**
+ * Wait for a card to enter the field
+ * The MFRC522 cannot detect a card on its own: a WUPA is sent every interval.
+ * With the IRQ pin enabled the host sleeps between and during the requests.
+ *
+ * Parameters:
+ * 	- uint8_t* id:
+ * 		Pointer to 5bytes long memory to store valid card id in.
+ * 	- unsigned int interval:
+ * 		Time between requests in ms
+ * 	- unsigned int timeout:
+ * 		Maximum wait in ms, 0 waits forever
+ *
+ * Returns MI_OK if a card was detected, MI_NOTAGERR on timeout
+ */
+extern MFRC522_Status_t MFRC522_WaitCard(uint8_t* id, unsigned int interval, unsigned int timeout);
+
 /**
  * Private functions
  */
@@ -263,6 +312,11 @@ extern MFRC522_Status_t MFRC522_Write(uint8_t blockAddr, uint8_t* writeData);
 extern void MFRC522_Halt(void);
 extern void MFRC522_WakeUp(void);
 extern void MFRC522_HAL_Delay(unsigned int ms);
+extern void MFRC522_HAL_DelayUs(unsigned int us);
+extern uint32_t MFRC522_HAL_Micros(void);
+extern int MFRC522_HAL_IrqInit(unsigned int gpio);
+extern void MFRC522_HAL_IrqClose(void);
+extern int MFRC522_HAL_IrqWait(unsigned int us, uint64_t *timestamp);
 
 char *MFRC522_TypeToString(PICC_TYPE_t type);
 int MFRC522_ParseType(uint8_t TagSelectRet);
@@ -27,12 +27,31 @@ int main(int argc, char **argv) {
 	uint8_t CardID[5] = { 0x00, };
 	uint8_t tagType[16] = {0x00,};
 	static char command_buffer[1024];
+	int opt;
+	int irq_gpio = -1;
+
+	//-i <gpio>: BCM GPIO wired to the IRQ pin of the module
+	while ((opt = getopt(argc, argv, "i:")) != -1) {
+		if (opt == 'i') {
+			irq_gpio = atoi(optarg);
+		} else {
+			printf("Usage: %s [-i irq_gpio]\r\n", argv[0]);
+			exit(-1);
+		}
+	}
 
 	ret = MFRC522_Init('B');
 	if (ret < 0) {
 		printf("Failed to initialize.\r\nProgram exit.\r\n");
 		exit(-1);
 	}
+	if (irq_gpio >= 0) {
+		if (MFRC522_EnableIrq(irq_gpio) < 0) {
+			printf("IRQ on GPIO %d unavailable, polling instead.\r\n", irq_gpio);
+		} else {
+			printf("Waiting on IRQ, GPIO %d\r\n", irq_gpio);
+		}
+	}
 
 	printf("User Space RC522 Application\r\n");
 
@@ -18,15 +18,25 @@
  */
 #include "mfrc522.h"
 #include <stdint.h>
+#include <stddef.h>
 #include <wiringPi.h>
 /* HAL prototypes*/
 void MFRC522_HAL_init(void);
 void MFRC522_HAL_write(unsigned char addr, unsigned char val);
 unsigned char MFRC522_HAL_read(unsigned char addr);
 void MFRC522_HAL_Delay(unsigned int ms);
+void MFRC522_HAL_DelayUs(unsigned int us);
+uint32_t MFRC522_HAL_Micros(void);
+int MFRC522_HAL_IrqInit(unsigned int gpio);
+void MFRC522_HAL_IrqClose(void);
+int MFRC522_HAL_IrqWait(unsigned int us, uint64_t *timestamp);
 
 /* HAL prototypes end */
-static int Checking_Card = 0;
+static int Irq_Enabled = 0;
+static uint64_t Completion_Time = 0;
+
+static uint8_t MFRC522_WaitPolling(uint32_t start, uint8_t waitIRq, uint8_t *irq);
+static uint8_t MFRC522_WaitIrqPin(uint32_t start, uint8_t waitIRq, uint8_t *irq);
 
 int MFRC522_Setup(char Type){
 	wiringPiSetup();
@@ -64,6 +74,9 @@ int MFRC522_Setup(char Type){
 		MFRC522_WriteRegister(MFRC522_REG_T_MODE, 0x8D);
 		MFRC522_WriteRegister(MFRC522_REG_T_PRESCALER, 0x3E);
 	}
+	if (Irq_Enabled) {
+		MFRC522_WriteRegister(MFRC522_REG_DIV1_EN, 0x80);	//IRQPushPull=1, the reset cleared it
+	}
 	MFRC522_AntennaOn();		//Open the antenna
 	return 0;
 }
@@ -78,10 +91,8 @@ MFRC522_Status_t MFRC522_Check(uint8_t* id) {
 	MFRC522_Status_t status;
 	/* Must Clear Bit MFCrypto1On in Status2 reg in order to return to the card detect mode*/
 	MFRC522_ClearBitMask(MFRC522_REG_STATUS2,(1<<3));
-	Checking_Card = 1;
 	//Find cards, return card type
 	status = MFRC522_Request(PICC_CMD_WUPA, id);
-	Checking_Card = 0;
 	if (status == MI_OK) {
 		//Card detected
 		//Anti-collision, return card serial number 4 bytes
@@ -90,6 +101,38 @@ MFRC522_Status_t MFRC522_Check(uint8_t* id) {
 	return status;
 }
 
+int MFRC522_EnableIrq(unsigned int gpio) {
+	if (MFRC522_HAL_IrqInit(gpio) < 0) {
+		return -1;
+	}
+	MFRC522_WriteRegister(MFRC522_REG_DIV1_EN, 0x80);	//IRQPushPull=1, IRQ is a CMOS output
+	Irq_Enabled = 1;
+	return 0;
+}
+
+void MFRC522_DisableIrq(void) {
+	Irq_Enabled = 0;
+	MFRC522_HAL_IrqClose();
+}
+
+uint64_t MFRC522_GetCompletionTime(void) {
+	return Completion_Time;
+}
+
+MFRC522_Status_t MFRC522_WaitCard(uint8_t* id, unsigned int interval, unsigned int timeout) {
+	uint32_t start = MFRC522_HAL_Micros();
+
+	for (;;) {
+		if (MFRC522_Check(id) == MI_OK) {
+			return MI_OK;
+		}
+		if (timeout && (MFRC522_HAL_Micros() - start) / 1000 >= timeout) {
+			return MI_NOTAGERR;
+		}
+		MFRC522_HAL_Delay(interval);
+	}
+}
+
 MFRC522_Status_t MFRC522_Compare(uint8_t* CardID, uint8_t* CompareID) {
 	uint8_t i;
 	for (i = 0; i < 5; i++) {
@@ -160,6 +203,8 @@ MFRC522_Status_t MFRC522_ToCard(uint8_t command, uint8_t* sendData,
 	uint8_t lastBits;
 	uint8_t n;
 	uint16_t i;
+	uint32_t start;
+	uint8_t timedOut;
 
 	switch (command) {
 	case PCD_AUTHENT: {
@@ -176,8 +221,12 @@ MFRC522_Status_t MFRC522_ToCard(uint8_t command, uint8_t* sendData,
 		break;
 	}
 
-	MFRC522_WriteRegister(MFRC522_REG_COMM_IE_N, irqEn | 0x80);
+	//With the IRQ pin, route only the interrupts that end the wait: TxIRq would fire mid-exchange
+	MFRC522_WriteRegister(MFRC522_REG_COMM_IE_N, (Irq_Enabled ? waitIRq | 0x01 : irqEn) | 0x80);
 	MFRC522_ClearBitMask(MFRC522_REG_COMM_IRQ, 0x80);
+	if (Irq_Enabled) {
+		MFRC522_HAL_IrqWait(0, NULL);		//Drop edges of interrupts cleared above
+	}
 	MFRC522_SetBitMask(MFRC522_REG_FIFO_LEVEL, 0x80);
 
 	MFRC522_WriteRegister(MFRC522_REG_COMMAND, PCD_IDLE);
@@ -194,22 +243,17 @@ MFRC522_Status_t MFRC522_ToCard(uint8_t command, uint8_t* sendData,
 	}
 
 	//Waiting to receive data to complete
-	i = 2000;//i according to the clock frequency adjustment, the operator M1 card maximum waiting time 25ms???
-	do {
-		//CommIrqReg[7..0]
-		//Set1 TxIRq RxIRq IdleIRq HiAlerIRq LoAlertIRq ErrIRq TimerIRq
-		if (Checking_Card) {
-			MFRC522_HAL_Delay(16);
-		} else {
-			MFRC522_HAL_Delay(20);
-		}
-		n = MFRC522_ReadRegister(MFRC522_REG_COMM_IRQ);
-		i--;
-	} while ((i != 0) && !(n & 0x01) && !(n & waitIRq));
+	start = MFRC522_HAL_Micros();
+	Completion_Time = 0;
+	if (Irq_Enabled) {
+		timedOut = MFRC522_WaitIrqPin(start, waitIRq, &n);
+	} else {
+		timedOut = MFRC522_WaitPolling(start, waitIRq, &n);
+	}
 
 	MFRC522_ClearBitMask(MFRC522_REG_BIT_FRAMING, 0x80);		//StartSend=0
 	
-	if (i != 0) {
+	if (!timedOut) {
 		if (!(MFRC522_ReadRegister(MFRC522_REG_ERROR) & 0x1B)) {
 
 			if (n & irqEn & 0x01) {
@@ -247,6 +291,66 @@ MFRC522_Status_t MFRC522_ToCard(uint8_t command, uint8_t* sendData,
 	return status;
 }
 
+/*
+ * Poll CommIrqReg back to back first, a short exchange ends in about 1 ms, then back off.
+ * Bounded by wall-clock time, not by a number of polls. Returns 1 on timeout.
+ */
+static uint8_t MFRC522_WaitPolling(uint32_t start, uint8_t waitIRq, uint8_t *irq) {
+	uint32_t delay = 0;
+	uint8_t polls = 0;
+
+	for (;;) {
+		//CommIrqReg[7..0]
+		//Set1 TxIRq RxIRq IdleIRq HiAlerIRq LoAlertIRq ErrIRq TimerIRq
+		*irq = MFRC522_ReadRegister(MFRC522_REG_COMM_IRQ);
+		if ((*irq & 0x01) || (*irq & waitIRq)) {
+			return 0;
+		}
+		if ((uint32_t)(MFRC522_HAL_Micros() - start) >= MFRC522_TOCARD_TIMEOUT) {
+			return 1;
+		}
+		if (polls < MFRC522_POLL_FAST) {
+			polls++;
+			continue;
+		}
+		delay = delay ? delay * 2 : MFRC522_POLL_MIN_DELAY;
+		if (delay > MFRC522_POLL_MAX_DELAY) {
+			delay = MFRC522_POLL_MAX_DELAY;
+		}
+		MFRC522_HAL_DelayUs(delay);
+	}
+}
+
+/*
+ * Sleep on the IRQ pin edge and read CommIrqReg once per edge.
+ * No SPI traffic while the card answers. Falls back to polling if the GPIO fails.
+ * Returns 1 on timeout.
+ */
+static uint8_t MFRC522_WaitIrqPin(uint32_t start, uint8_t waitIRq, uint8_t *irq) {
+	uint32_t elapsed;
+	int ret;
+
+	for (;;) {
+		elapsed = MFRC522_HAL_Micros() - start;
+		if (elapsed >= MFRC522_TOCARD_TIMEOUT) {
+			Completion_Time = 0;
+			*irq = MFRC522_ReadRegister(MFRC522_REG_COMM_IRQ);	//Last look, an edge may have been lost
+			return !((*irq & 0x01) || (*irq & waitIRq));
+		}
+		ret = MFRC522_HAL_IrqWait(MFRC522_TOCARD_TIMEOUT - elapsed, &Completion_Time);
+		if (ret < 0) {
+			Completion_Time = 0;
+			return MFRC522_WaitPolling(start, waitIRq, irq);
+		}
+		if (ret > 0) {
+			*irq = MFRC522_ReadRegister(MFRC522_REG_COMM_IRQ);
+			if ((*irq & 0x01) || (*irq & waitIRq)) {
+				return 0;
+			}
+		}
+	}
+}
+
 MFRC522_Status_t MFRC522_Anticoll(uint8_t* serNum) {
 	MFRC522_Status_t status;
 	uint8_t i;
@@ -11,15 +11,20 @@
 #include <getopt.h>
 #include <fcntl.h>
 #include <string.h>
+#include <time.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <linux/types.h>
 #include <linux/spi/spidev.h>
+#include <linux/gpio.h>
 
 #define RFID_DEBUG(a)	puts(a)
 #define RFID_DEBUGF		printf
 #define SPI_DEV "/dev/spidev0.0"
+#define GPIO_DEV "/dev/gpiochip0"
 #define RFID_DelayMs(s)	usleep(s*1000)
 static int __spidev = 0;
+static int __irqline = -1;
 static struct spi_ioc_transfer spixfr;
 
 static uint32_t mode = SPI_MODE_0;
@@ -33,6 +38,81 @@ static void pabort(const char *s)
 void MFRC522_HAL_Delay(unsigned int ms){
 	usleep(ms * 1000);
 }
+void MFRC522_HAL_DelayUs(unsigned int us){
+	usleep(us);
+}
+uint32_t MFRC522_HAL_Micros(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+void MFRC522_HAL_IrqClose(void) {
+	if (__irqline < 0)
+		return;
+	close(__irqline);
+	__irqline = -1;
+}
+
+/*
+ * Request the GPIO wired to IRQ as an input with falling edge events.
+ * IRQ is active low (ComIEnReg IRqInv); the pull-up also covers open-drain mode.
+ */
+int MFRC522_HAL_IrqInit(unsigned int gpio) {
+	struct gpio_v2_line_request request;
+	int chip;
+
+	MFRC522_HAL_IrqClose();
+	chip = open(GPIO_DEV, O_RDWR | O_CLOEXEC);
+	if (chip < 0) {
+		perror("Cannot open "GPIO_DEV);
+		return -1;
+	}
+	memset(&request, 0, sizeof(request));
+	request.offsets[0] = gpio;
+	request.num_lines = 1;
+	strncpy(request.consumer, "MFRC522", sizeof(request.consumer) - 1);
+	request.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_FALLING
+			| GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+	if (ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+		perror("Cannot request IRQ GPIO");
+		close(chip);
+		return -1;
+	}
+	close(chip);
+	__irqline = request.fd;
+	return 0;
+}
+
+/*
+ * Sleep until an IRQ edge or the timeout, and consume every queued edge.
+ * timestamp receives the kernel time of the first edge in ns.
+ * Returns 1 on an edge, 0 on timeout, -1 on error.
+ */
+int MFRC522_HAL_IrqWait(unsigned int us, uint64_t *timestamp) {
+	struct gpio_v2_line_event events[16];
+	struct pollfd pfd;
+	ssize_t len;
+	int ret;
+
+	if (__irqline < 0)
+		return -1;
+	pfd.fd = __irqline;
+	pfd.events = POLLIN;
+	ret = poll(&pfd, 1, (us + 999) / 1000);
+	if (ret <= 0)
+		return ret;
+	len = read(__irqline, events, sizeof(events));
+	if (len < (ssize_t)sizeof(events[0]))
+		return -1;
+	if (timestamp)
+		*timestamp = events[0].timestamp_ns;
+	/* drain edges beyond the buffer */
+	while (poll(&pfd, 1, 0) > 0
+			&& read(__irqline, events, sizeof(events)) > 0)
+		;
+	return 1;
+}
 void MFRC522_HAL_init(void) {
 	int ret;
 
@@ -0,0 +1,153 @@
+/**********************************************************************
+* Filename    : SensorCache.cpp
+* Description : Shared memory cache of the latest sensor readings.
+*               One daemon writes, any number of processes read with
+*               a seqlock, without touching the devices.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+**********************************************************************/
+#include "SensorCache.hpp"
+#include <string.h>                                      // memset(), strncpy()
+#include <fcntl.h>                                       // O_* flags
+#include <unistd.h>                                      // ftruncate(), getpid()
+#include <signal.h>                                      // kill()
+#include <errno.h>                                       // errno
+#include <sys/mman.h>                                    // shm_open(), mmap()
+
+// The sequence counters are shared between processes, so they must not hide a lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "seqlock needs lock-free 32-bit atomics");
+
+SensorCache::SensorCache() {
+    segment = NULL;                                      // Nothing mapped
+    owner = false;
+    name[0] = '\0';
+}
+
+SensorCache::~SensorCache() {
+    close();                                             // Unmap the segment
+}
+
+// Function to create the segment, called once by the daemon.
+// A segment left by a daemon that died is taken over; one whose daemon still runs is refused.
+int SensorCache::create(const char *name) {
+    if (open(name) == SENSORCACHE_OK) {                  // Existing segment of the current layout
+        bool alive = isDaemonAlive() && (pid_t)segment->pid != getpid();
+        close();                                         // Read-only mapping, does not remove the object
+        if (alive) return SENSORCACHE_ERROR_BUSY;
+    }
+    close();
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_CLOEXEC, 0644);  // Readers only need read access
+    if (fd < 0) return SENSORCACHE_ERROR_SHM;
+    if (ftruncate(fd, sizeof(SensorCacheSegment)) < 0) {  // Size the object for the current layout
+        ::close(fd);
+        return SENSORCACHE_ERROR_SHM;
+    }
+    void *map = mmap(NULL, sizeof(SensorCacheSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);                                         // The mapping keeps the object open
+    if (map == MAP_FAILED) return SENSORCACHE_ERROR_SHM;
+
+    segment = (SensorCacheSegment *)map;
+    owner = true;
+    strncpy(this->name, name, sizeof(this->name) - 1);
+    this->name[sizeof(this->name) - 1] = '\0';
+    segment->magic = 0;                                  // Readers reject the segment until it is initialized
+    std::atomic_thread_fence(std::memory_order_release);
+    memset((void *)segment->sensors, 0, sizeof(segment->sensors));  // Sequence 0, no readings
+    segment->version = SENSORCACHE_VERSION;
+    segment->pid = getpid();
+    std::atomic_thread_fence(std::memory_order_release);
+    segment->magic = SENSORCACHE_MAGIC;                  // Publish the initialized segment
+    return SENSORCACHE_OK;
+}
+
+// Function to map an existing segment read-only, called by every reader
+int SensorCache::open(const char *name) {
+    close();
+    int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0) return SENSORCACHE_ERROR_SHM;
+    void *map = mmap(NULL, sizeof(SensorCacheSegment), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) return SENSORCACHE_ERROR_SHM;
+
+    SensorCacheSegment *s = (SensorCacheSegment *)map;
+    if (s->magic != SENSORCACHE_MAGIC || s->version != SENSORCACHE_VERSION) {  // Not initialized or another layout
+        munmap(map, sizeof(SensorCacheSegment));
+        return SENSORCACHE_ERROR_VERSION;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    segment = s;
+    owner = false;
+    return SENSORCACHE_OK;
+}
+
+// Function to unmap the segment; the daemon also removes the object
+void SensorCache::close() {
+    if (segment == NULL) return;
+    munmap(segment, sizeof(SensorCacheSegment));
+    if (owner) shm_unlink(name);                         // Readers keep their mapping until they close
+    segment = NULL;
+    owner = false;
+}
+
+// Function to record the sample period of a sensor
+void SensorCache::setPeriod(int sensor, uint32_t period) {
+    if (segment == NULL || !owner || sensor < 0 || sensor >= SENSORCACHE_SENSORS) return;
+    segment->sensors[sensor].period = period;
+}
+
+// Function to append a reading. Each sensor must have a single writing thread.
+void SensorCache::publish(int sensor, const SensorCacheReading *reading) {
+    if (segment == NULL || !owner || sensor < 0 || sensor >= SENSORCACHE_SENSORS) return;
+    SensorCacheSlot *slot = &segment->sensors[sensor];
+    uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+
+    slot->sequence.store(sequence + 1, std::memory_order_relaxed);  // Odd: readers retry
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->history[slot->count & (SENSORCACHE_HISTORY - 1)] = *reading;
+    slot->count++;
+    slot->sequence.store(sequence + 2, std::memory_order_release);  // Even again: reading complete
+}
+
+// Function to copy the newest reading; false when none is published or the writer kept it busy
+bool SensorCache::read(int sensor, SensorCacheReading *reading) {
+    return readHistory(sensor, reading, 1) == 1;
+}
+
+// Function to copy up to maxReadings of the newest readings, oldest first.
+// Seqlock read: copy, then retry if the daemon wrote meanwhile. Costs only memory reads.
+uint32_t SensorCache::readHistory(int sensor, SensorCacheReading *readings, uint32_t maxReadings) {
+    if (segment == NULL || sensor < 0 || sensor >= SENSORCACHE_SENSORS) return 0;
+    SensorCacheSlot *slot = &segment->sensors[sensor];
+    if (maxReadings > SENSORCACHE_HISTORY) maxReadings = SENSORCACHE_HISTORY;
+
+    for (int retry = 0; retry < SENSORCACHE_READ_RETRIES; retry++) {
+        uint32_t before = slot->sequence.load(std::memory_order_acquire);
+        if (before & 1) continue;                        // Write in progress
+        uint32_t count = slot->count;
+        uint32_t n = count < maxReadings ? count : maxReadings;
+        for (uint32_t i = 0; i < n; i++) {
+            readings[i] = slot->history[(count - n + i) & (SENSORCACHE_HISTORY - 1)];
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) == before) return n;  // No write overlapped the copy
+    }
+    return 0;
+}
+
+// Function to get the sample period of a sensor in ms
+uint32_t SensorCache::getPeriod(int sensor) {
+    if (segment == NULL || sensor < 0 || sensor >= SENSORCACHE_SENSORS) return 0;
+    return segment->sensors[sensor].period;
+}
+
+// Function to get the number of readings published for a sensor
+uint32_t SensorCache::getCount(int sensor) {
+    if (segment == NULL || sensor < 0 || sensor >= SENSORCACHE_SENSORS) return 0;
+    return segment->sensors[sensor].sequence.load(std::memory_order_acquire) / 2;
+}
+
+// Function to check that the daemon behind the segment still runs
+bool SensorCache::isDaemonAlive() {
+    if (segment == NULL) return false;
+    return kill(segment->pid, 0) == 0 || errno == EPERM;  // EPERM: alive but owned by another user
+}
@@ -0,0 +1,83 @@
+/**********************************************************************
+* Filename    : SensorCache.hpp
+* Description : Shared memory cache of the latest sensor readings.
+*               One daemon writes, any number of processes read with
+*               a seqlock, without touching the devices.
+* Author      : freenove & Philippe Jos
+* Modified    : 18/10/2026
+**********************************************************************/
+#ifndef _SENSORCACHE_H_                      // Include guard to prevent multiple inclusions
+#define _SENSORCACHE_H_
+
+#include <stdint.h>                          // Include standard integer types
+#include <atomic>                            // Include atomic sequence counters
+
+// Return flags of the cache functions
+#define SENSORCACHE_OK              0        // Success flag
+#define SENSORCACHE_ERROR_SHM       -1       // Shared memory open, size or map error flag
+#define SENSORCACHE_ERROR_VERSION   -2       // Segment written by an incompatible daemon flag
+#define SENSORCACHE_ERROR_BUSY      -3       // Segment owned by a running daemon flag
+
+#define SENSORCACHE_NAME            "/freenove-sensors"  // Default shared memory object, /dev/shm/freenove-sensors
+#define SENSORCACHE_MAGIC           0x53454E53  // "SENS"
+#define SENSORCACHE_VERSION         1        // Layout version, bumped on any change below
+#define SENSORCACHE_HISTORY         256      // Readings kept per sensor, power of two
+#define SENSORCACHE_VALUES          8        // Values per reading
+#define SENSORCACHE_READ_RETRIES    1000     // Seqlock retries before a read gives up
+
+// Sensors in the cache and the meaning of their values
+enum {
+    SENSORCACHE_DHT,                         // values[0] humidity in %, values[1] temperature in °C
+    SENSORCACHE_BMP180,                      // values[0] temperature in °C, [1] pressure in hPa, [2] altitude in m, [3] vertical speed in m/s
+    SENSORCACHE_ADC,                         // values[n] voltage of channel n in V
+    SENSORCACHE_SENSORS                      // Number of sensors
+};
+
+// One reading of one sensor
+struct SensorCacheReading {
+    uint64_t timestamp;                      // Sample time, CLOCK_MONOTONIC ns (same clock in every process)
+    uint32_t valueCount;                     // Valid entries in values
+    float values[SENSORCACHE_VALUES];        // Sensor values, see the sensor list above
+};
+
+// Everything the daemon publishes for one sensor
+struct alignas(64) SensorCacheSlot {
+    std::atomic<uint32_t> sequence;          // Seqlock, odd while the daemon writes
+    uint32_t period;                         // Configured sample period in ms, 0 when the sensor is off
+    uint32_t count;                          // Readings published since the daemon started
+    uint32_t reserved;
+    SensorCacheReading history[SENSORCACHE_HISTORY];  // Ring of readings, the newest at (count - 1) % SENSORCACHE_HISTORY
+};
+
+// Layout of the shared memory object
+struct SensorCacheSegment {
+    uint32_t magic;                          // SENSORCACHE_MAGIC once the daemon has initialized the segment
+    uint32_t version;                        // SENSORCACHE_VERSION
+    uint32_t pid;                            // Process id of the daemon
+    uint32_t reserved;
+    SensorCacheSlot sensors[SENSORCACHE_SENSORS];  // One slot per sensor
+};
+
+class SensorCache {
+    public:
+        SensorCache();                       // Constructor, nothing mapped
+        ~SensorCache();                      // Destructor, unmaps the segment
+        int create(const char *name = SENSORCACHE_NAME);  // Daemon: create and map the segment for writing
+        int open(const char *name = SENSORCACHE_NAME);    // Reader: map an existing segment read-only
+        void close();                        // Unmap the segment, the daemon also removes it
+
+        void setPeriod(int sensor, uint32_t period);  // Daemon: record the sample period in ms
+        void publish(int sensor, const SensorCacheReading *reading);  // Daemon: append a reading
+
+        bool read(int sensor, SensorCacheReading *reading);  // Copy the newest reading, false if there is none
+        uint32_t readHistory(int sensor, SensorCacheReading *readings, uint32_t maxReadings);  // Copy the newest readings, oldest first
+        uint32_t getPeriod(int sensor);      // Sample period in ms, 0 when the sensor is off
+        uint32_t getCount(int sensor);       // Readings published so far
+        bool isDaemonAlive();                // The daemon that wrote the segment is still running
+    private:
+        SensorCacheSegment *segment;         // Mapped segment, NULL when closed
+        bool owner;                          // Mapped by create(), removes the object on close()
+        char name[64];                       // Shared memory object name
+};
+
+#endif                                        // End of include guard
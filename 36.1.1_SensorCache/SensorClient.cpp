@@ -0,0 +1,55 @@
+/*
+Filename    : SensorClient.cpp
+Description : Print the sensor readings published by SensorDaemon, without touching the devices.
+Author      : freenove & Philippe Jos
+Modified    : 18/10/2026
+*/
+#include <stdio.h>                                          // Include standard I/O library
+#include <unistd.h>                                         // Include usleep()
+#include <time.h>                                           // Include clock_gettime()
+#include "SensorCache.hpp"                                  // Include shared memory cache
+
+SensorCache cache;                                          // Read-only view of the daemon segment
+
+// Function to get the age of a reading in ms
+double age(const SensorCacheReading *reading) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);                    // Same clock as the daemon
+    uint64_t now = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    return (now - reading->timestamp) / 1e6;
+}
+
+int setup() {
+    int result = cache.open();                              // Map the segment read-only
+    if (result != SENSORCACHE_OK) {
+        printf("No sensor cache found, start SensorDaemon first\n"); // Print error message
+    }
+    return result;
+}
+
+void loop() {
+    SensorCacheReading reading;
+    if (!cache.isDaemonAlive()) {                           // A restarted daemon creates a new segment
+        printf("SensorDaemon stopped, reopening\n");
+        cache.open();
+    }
+    if (cache.read(SENSORCACHE_DHT, &reading)) {            // Newest DHT11 reading
+        printf("Humidity: %.2f %%\t Temperature: %.2f °C\t(%.0f ms ago)\n", reading.values[0], reading.values[1], age(&reading));
+    }
+    if (cache.read(SENSORCACHE_BMP180, &reading)) {         // Newest BMP180 reading
+        printf("Pressure: %.2f hPa\t Altitude: %.1f m\t(%.0f ms ago)\n", reading.values[1], reading.values[2], age(&reading));
+    }
+    if (cache.read(SENSORCACHE_ADC, &reading)) {            // Newest ADC reading
+        printf("Voltage A0: %.2f V\t(%.0f ms ago)\n", reading.values[0], age(&reading));
+    }
+    printf("-------------------------------------------------\n"); // Print separator line
+    usleep(1000 * 1000);                                    // Wait for 1 second
+}
+
+int main(void) {
+    if (setup() != SENSORCACHE_OK) return -1;               // Call setup function, exit if it fails
+    while (1) {
+        loop();
+    }
+    return 0;                                               // Return 0 (never reached)
+}
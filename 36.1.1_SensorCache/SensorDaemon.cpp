@@ -0,0 +1,212 @@
+/*
+Filename    : SensorDaemon.cpp
+Description : Sample the DHT11, the BMP180 and the ADC module, each at its own rate, and publish
+              the readings in shared memory. Other programs read them with SensorCache::open()
+              instead of opening the devices themselves.
+Author      : freenove & Philippe Jos
+Modified    : 18/10/2026
+*/
+#include <stdio.h>                                          // Include standard I/O library
+#include <stdlib.h>                                         // Include standard library
+#include <unistd.h>                                         // Include getopt()
+#include <signal.h>                                         // Include signal masks
+#include <time.h>                                           // Include clock_gettime()
+#include <pthread.h>                                        // Include POSIX threads
+#include <wiringPi.h>                                       // Include WiringPi library
+#include <ADCDevice.hpp>                                    // Include ADCDevice header
+#include "../21.1.1_DHT11/DHT.hpp"                          // Include DHT library
+#include "../33.1.1_Barometer/BMP180Sampler.hpp"            // Include BMP180 background sampler
+#include "../33.1.1_Barometer/BMP180Altitude.hpp"           // Include BMP180 altitude filter
+#include "SensorCache.hpp"                                  // Include shared memory cache
+
+#define DHT11_PIN           0                               // Default wiringPi pin of the DHT11
+#define DHT11_PERIOD_MIN    1000                            // The DHT11 needs 1 s between reads
+#define ADC_CHANNELS_MAX    8                               // ADS7830 has 8 channels
+#define PCF8591_CHANNELS    4                               // PCF8591 has 4 channels
+
+struct Settings {
+    const char *name;                                       // Shared memory object name
+    int dhtPin;                                             // wiringPi pin of the DHT11
+    unsigned int dhtPeriod;                                 // DHT11 period in ms, 0 = off
+    unsigned int bmpPeriod;                                 // BMP180 period in ms, 0 = off
+    unsigned int adcPeriod;                                 // ADC period in ms, 0 = off
+    int adcChannels;                                        // ADC channels to read from A0
+};
+
+Settings settings = {SENSORCACHE_NAME, DHT11_PIN, 2000, 100, 100, 1}; // Defaults
+SensorCache cache;                                          // Segment written by this daemon
+bool stopping = false;                                      // Set once a stop signal arrives
+pthread_mutex_t stopLock = PTHREAD_MUTEX_INITIALIZER;       // Protects stopping
+pthread_cond_t stopCond;                                    // Wakes the sampling threads on stop
+
+uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Function to sleep until the next period of a sensor, returns false when the daemon stops
+bool waitNext(uint64_t *deadline, unsigned int period) {
+    uint64_t now = monotonicNs();
+    *deadline += period * 1000000ULL;                       // Fixed schedule, no drift
+    if (*deadline < now) *deadline = now;                   // Fell behind: restart the schedule
+    struct timespec ts;
+    ts.tv_sec = *deadline / 1000000000ULL;
+    ts.tv_nsec = *deadline % 1000000000ULL;
+    pthread_mutex_lock(&stopLock);
+    while (!stopping && pthread_cond_timedwait(&stopCond, &stopLock, &ts) == 0); // Returns ETIMEDOUT at the deadline
+    bool running = !stopping;
+    pthread_mutex_unlock(&stopLock);
+    return running;
+}
+
+void *dhtThread(void *) {
+    DHT dht;                                                // Selects the IIO driver when it is loaded
+    uint64_t deadline = monotonicNs();
+    do {
+        if (dht.readDHT11(settings.dhtPin) == DHTLIB_OK) {  // Only good readings are published
+            SensorCacheReading reading;
+            reading.timestamp = monotonicNs();
+            reading.valueCount = 2;
+            reading.values[0] = dht.humidity;
+            reading.values[1] = dht.temperature;
+            cache.publish(SENSORCACHE_DHT, &reading);
+        }
+    } while (waitNext(&deadline, settings.dhtPeriod));
+    return NULL;
+}
+
+void *bmpThread(void *) {
+    BMP180 bmp180;                                          // Driver with cached calibration
+    BMP180Altitude altitude;                                // Altitude and vertical speed filter
+    BMP180Sample samples[BMP180_SAMPLER_RING_SIZE];         // Samples since the last period
+    if (bmp180.begin() != BMP180_OK) {
+        printf("BMP180 not found, pressure disabled\n");    // Print error message
+        cache.setPeriod(SENSORCACHE_BMP180, 0);
+        return NULL;
+    }
+    BMP180Sampler sampler(&bmp180);                         // Converts in the background at the period
+    if (!sampler.start(settings.bmpPeriod * 1000)) {
+        printf("Failed to start the BMP180 sampler\n");     // Print error message
+        cache.setPeriod(SENSORCACHE_BMP180, 0);
+        return NULL;
+    }
+    uint64_t deadline = monotonicNs();
+    while (waitNext(&deadline, settings.bmpPeriod)) {
+        uint32_t count = sampler.read(samples, BMP180_SAMPLER_RING_SIZE);
+        for (uint32_t i = 0; i < count; i++) {              // Publish every sample, filtered
+            SensorCacheReading reading;
+            altitude.update(&samples[i]);
+            reading.timestamp = samples[i].timestamp;
+            reading.valueCount = 4;
+            reading.values[0] = samples[i].temperature / 10.0;
+            reading.values[1] = samples[i].pressure / 100.0;
+            reading.values[2] = altitude.getAltitude();
+            reading.values[3] = altitude.getVerticalSpeed();
+            cache.publish(SENSORCACHE_BMP180, &reading);
+        }
+    }
+    sampler.stop();
+    return NULL;
+}
+
+void *adcThread(void *) {
+    int channels = settings.adcChannels;
+    ADCDevice *adc = new ADCDevice();                       // Detect the ADC module like 07.1.1_ADC
+    if (adc->detectI2C(0x48)) {                             // Detect the pcf8591
+        delete adc;
+        adc = new PCF8591();
+        if (channels > PCF8591_CHANNELS) {                  // Higher inputs do not exist on this module
+            printf("PCF8591 has %d channels, reading A0-A%d\n", PCF8591_CHANNELS, PCF8591_CHANNELS - 1);
+            channels = PCF8591_CHANNELS;
+        }
+    } else if (adc->detectI2C(0x4b)) {                      // Detect the ads7830
+        delete adc;
+        adc = new ADS7830();
+    } else {
+        printf("No ADC module found, ADC disabled\n");      // Print error message
+        delete adc;
+        cache.setPeriod(SENSORCACHE_ADC, 0);
+        return NULL;
+    }
+    uint64_t deadline = monotonicNs();
+    do {
+        SensorCacheReading reading;
+        reading.timestamp = monotonicNs();
+        reading.valueCount = channels;
+        for (int i = 0; i < channels; i++) {
+            reading.values[i] = (float)adc->analogRead(i) / 255.0 * 3.3; // Convert to voltage
+        }
+        cache.publish(SENSORCACHE_ADC, &reading);
+    } while (waitNext(&deadline, settings.adcPeriod));
+    delete adc;
+    return NULL;
+}
+
+void usage(const char *program) {
+    printf("Usage: %s [-n name] [-p dht pin] [-d dht ms] [-b bmp180 ms] [-a adc ms] [-c adc channels]\n"
+           "A period of 0 disables the sensor.\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    int option;
+    while ((option = getopt(argc, argv, "n:p:d:b:a:c:h")) != -1) { // Read the command line settings
+        switch (option) {
+            case 'n': settings.name = optarg; break;
+            case 'p': settings.dhtPin = atoi(optarg); break;
+            case 'd': settings.dhtPeriod = atoi(optarg); break;
+            case 'b': settings.bmpPeriod = atoi(optarg); break;
+            case 'a': settings.adcPeriod = atoi(optarg); break;
+            case 'c': settings.adcChannels = atoi(optarg); break;
+            default: usage(argv[0]); return -1;
+        }
+    }
+    if (settings.dhtPeriod > 0 && settings.dhtPeriod < DHT11_PERIOD_MIN) settings.dhtPeriod = DHT11_PERIOD_MIN;
+    if (settings.adcChannels < 1) settings.adcChannels = 1;
+    if (settings.adcChannels > ADC_CHANNELS_MAX) settings.adcChannels = ADC_CHANNELS_MAX;
+
+    int result = cache.create(settings.name);               // Create the shared memory segment
+    if (result == SENSORCACHE_ERROR_BUSY) {
+        printf("Another daemon is already writing %s\n", settings.name); // Print error message
+        return -1;
+    } else if (result != SENSORCACHE_OK) {
+        perror("Failed to create the shared memory segment"); // Print error message
+        return -1;
+    }
+    cache.setPeriod(SENSORCACHE_DHT, settings.dhtPeriod);
+    cache.setPeriod(SENSORCACHE_BMP180, settings.bmpPeriod);
+    cache.setPeriod(SENSORCACHE_ADC, settings.adcPeriod);
+
+    pthread_condattr_t attr;                                // Timed waits use the monotonic clock
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&stopCond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    sigset_t signals;                                       // Only main() receives the stop signals
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    pthread_t threads[SENSORCACHE_SENSORS];                 // One sampling thread per sensor
+    bool started[SENSORCACHE_SENSORS] = {false};
+    void *(*entries[SENSORCACHE_SENSORS])(void *) = {dhtThread, bmpThread, adcThread};
+    unsigned int periods[SENSORCACHE_SENSORS] = {settings.dhtPeriod, settings.bmpPeriod, settings.adcPeriod};
+    for (int i = 0; i < SENSORCACHE_SENSORS; i++) {
+        if (periods[i] > 0) started[i] = pthread_create(&threads[i], NULL, entries[i], NULL) == 0;
+    }
+    printf("Publishing sensor readings in /dev/shm%s\n", settings.name);
+
+    int received;
+    sigwait(&signals, &received);                           // Run until SIGINT or SIGTERM
+    pthread_mutex_lock(&stopLock);
+    stopping = true;
+    pthread_cond_broadcast(&stopCond);                      // Wake the threads out of their waits
+    pthread_mutex_unlock(&stopLock);
+    for (int i = 0; i < SENSORCACHE_SENSORS; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+    }
+    cache.close();                                          // Remove the segment
+    return 0;
+}